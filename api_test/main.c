@@ -534,6 +534,43 @@ parser(test_batch_runner *runner)
 {
 	test_md_to_html(runner, "No newline", "<p>No newline</p>\n",
 			"document without trailing newline");
+
+	// long enough to need several reads when not mapped
+	char *text = (char *)malloc(200000);
+	size_t len = 0;
+	int i;
+	for (i = 0; i < 5000; i++) {
+		len += sprintf(text + len, "- item %d\n  [link](/%d)\n", i, i);
+	}
+	len += sprintf(text + len, "last line");
+	cmark_node *doc = cmark_parse_document(text, len, CMARK_OPT_DEFAULT);
+	char *expected = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	cmark_node_free(doc);
+
+	FILE *fp = tmpfile();
+	fwrite(text, 1, len, fp);
+	rewind(fp);
+	doc = cmark_parse_file(fp, CMARK_OPT_DEFAULT);
+	char *html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "parse file");
+	free(html);
+	cmark_node_free(doc);
+
+	// a file that was partly read already is read from where it is
+	fseek(fp, 10, SEEK_SET);
+	cmark_parser *parser = cmark_parser_new(CMARK_OPT_DEFAULT);
+	cmark_parser_feed(parser, text, 10);
+	cmark_parser_feed_file(parser, fp);
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "feed partly read file");
+	free(html);
+	cmark_node_free(doc);
+
+	fclose(fp);
+	free(expected);
+	free(text);
 }
 
 static void
@@ -567,6 +604,1207 @@ render_html(test_batch_runner *runner)
 	cmark_node_free(doc);
 }
 
+static void
+binary_serialization(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"{toc}\n"
+		"\n"
+		"# One\n"
+		"\n"
+		"## Two {#two}\n"
+		"\n"
+		"3. a\n"
+		"4. b\n"
+		"\n"
+		"```c info\n"
+		"int x;\n"
+		"```\n"
+		"\n"
+		"> [link](/u \"t\") ![*img*](/i) `code`  \n"
+		"> end\n"
+		"\n"
+		"<div>x</div>\n";
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_DEFAULT);
+	size_t len;
+	unsigned char *image = cmark_serialize_binary(doc, &len);
+	OK(runner, image != NULL && len > 0, "serialize document");
+
+	cmark_doc *mapped = cmark_doc_map(image, len);
+	OK(runner, mapped != NULL, "map serialized document");
+
+	char *expected = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	char *html = cmark_doc_render_html(mapped, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render mapped document as HTML");
+	free(expected);
+	free(html);
+
+	expected = cmark_render_xml(doc, CMARK_OPT_SOURCEPOS);
+	html = cmark_doc_render_xml(mapped, CMARK_OPT_SOURCEPOS);
+	STR_EQ(runner, html, expected, "render mapped document as XML");
+	free(expected);
+	free(html);
+	cmark_doc_free(mapped);
+
+	OK(runner, cmark_doc_map(image, len - 1) == NULL,
+	   "reject truncated image");
+	OK(runner, cmark_doc_map(image, 16) == NULL,
+	   "reject image without node table");
+
+	image[0] = 'X';
+	OK(runner, cmark_doc_map(image, len) == NULL, "reject bad magic");
+	image[0] = 'C';
+
+	// the first node record follows the 32-byte header; make the
+	// document node claim one more descendant than there are nodes
+	unsigned int end;
+	memcpy(&end, image + 36, sizeof(end));
+	unsigned int bad_end = end + 1;
+	memcpy(image + 36, &bad_end, sizeof(bad_end));
+	OK(runner, cmark_doc_map(image, len) == NULL,
+	   "reject node extending past its parent");
+	memcpy(image + 36, &end, sizeof(end));
+	mapped = cmark_doc_map(image, len);
+	OK(runner, mapped != NULL, "map restored image");
+	cmark_doc_free(mapped);
+
+	free(image);
+
+	// a subtree can be serialized on its own
+	cmark_node *header = cmark_node_next(cmark_node_first_child(doc));
+	image = cmark_serialize_binary(header, &len);
+	mapped = cmark_doc_map(image, len);
+	expected = cmark_render_html(header, CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html(mapped, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render mapped subtree");
+	free(expected);
+	free(html);
+	cmark_doc_free(mapped);
+	free(image);
+
+	cmark_node_free(doc);
+}
+
+// Applies an edit to both the document and 'text'.  Returns 1 on
+// success.
+static int
+apply_edit(cmark_doc *doc, char *text, size_t *len, size_t offset,
+           size_t old_len, const char *new_text)
+{
+	size_t new_len = strlen(new_text);
+
+	if (!cmark_doc_apply_edit(doc, offset, old_len, new_text, new_len)) {
+		return 0;
+	}
+	memmove(text + offset + new_len, text + offset + old_len,
+	        *len - offset - old_len);
+	memcpy(text + offset, new_text, new_len);
+	*len += new_len - old_len;
+	return 1;
+}
+
+// Returns 1 if the document matches a parse of the whole of 'text'.
+static int
+matches_full_parse(cmark_doc *doc, const char *text, size_t len)
+{
+	cmark_node *expected_doc;
+	char *expected;
+	char *actual;
+	int ok;
+
+	expected_doc = cmark_parse_document(text, len, CMARK_OPT_DEFAULT);
+	expected = cmark_render_xml(expected_doc, CMARK_OPT_SOURCEPOS);
+	actual = cmark_render_xml(cmark_doc_get_root(doc), CMARK_OPT_SOURCEPOS);
+	ok = strcmp(expected, actual) == 0;
+	free(expected);
+	free(actual);
+	cmark_node_free(expected_doc);
+	return ok;
+}
+
+// Applies an edit to both the document and 'text', and checks that the
+// document matches a parse of the whole new text.  Returns 1 if so.
+static int
+check_edit(cmark_doc *doc, char *text, size_t *len, size_t offset,
+           size_t old_len, const char *new_text)
+{
+	return apply_edit(doc, text, len, offset, old_len, new_text) &&
+	       matches_full_parse(doc, text, *len);
+}
+
+static void
+incremental_parsing(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"# Title\n"
+		"\n"
+		"Some [text][a] and [b].\n"
+		"More text\n"
+		"\n"
+		"- one\n"
+		"- two\n"
+		"\n"
+		"  still two\n"
+		"\n"
+		"> quote [a]\n"
+		"lazy\n"
+		"\n"
+		"```\n"
+		"code\n"
+		"\n"
+		"```\n"
+		"\n"
+		"    indented\n"
+		"\n"
+		"Setext\n"
+		"------\n"
+		"\n"
+		"[a]: /first\n"
+		"[b]: /b 'title'\n"
+		"[a]: /second\n"
+		"\n"
+		"<div>\n"
+		"html\n"
+		"</div>\n"
+		"\n"
+		"1. last [b]\n";
+	static const char *snippets[] = {
+		"", "\n", "\n\n", "x", "- ", "> ", "```\n", "# ", "---\n",
+		"    ", "[a]: /new\n", "[a]", "[b]: /x\n", "1. ", "*", "<div>\n",
+	};
+	char text[8192];
+	size_t len = sizeof(markdown) - 1;
+	unsigned int seed = 12345;
+	int failures = 0;
+	int i;
+
+	memcpy(text, markdown, len);
+	cmark_doc *doc = cmark_doc_new(text, len, CMARK_OPT_DEFAULT);
+
+	char *expected = cmark_render_html(cmark_doc_get_root(doc),
+	                                   CMARK_OPT_DEFAULT);
+	char *html;
+	OK(runner, strstr(expected, "href=\"/first\"") != NULL,
+	   "first definition wins");
+	free(expected);
+
+	// remove the first definition of [a], revealing the second
+	const char *def = strstr(text, "[a]: /first\n");
+	OK(runner, check_edit(doc, text, &len, def - text, 12, ""),
+	   "remove reference definition");
+	html = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	OK(runner, strstr(html, "href=\"/second\"") != NULL &&
+	   strstr(html, "/first") == NULL, "links use revealed definition");
+	free(html);
+
+	OK(runner, cmark_doc_apply_edit(doc, len + 1, 0, "x", 1) == 0,
+	   "reject edit past end");
+	OK(runner, cmark_doc_apply_edit(doc, len - 1, 2, "", 0) == 0,
+	   "reject edit range past end");
+
+	for (i = 0; i < 400; i++) {
+		seed = seed * 1103515245 + 12345;
+		size_t offset = (seed >> 8) % (len + 1);
+		seed = seed * 1103515245 + 12345;
+		size_t old_len = (seed >> 8) % 8;
+		if (old_len > len - offset) {
+			old_len = len - offset;
+		}
+		seed = seed * 1103515245 + 12345;
+		const char *snippet = snippets[(seed >> 8) %
+		                               (sizeof(snippets) / sizeof(*snippets))];
+		if (len + strlen(snippet) >= sizeof(text)) {
+			break;
+		}
+		if (!check_edit(doc, text, &len, offset, old_len, snippet)) {
+			failures++;
+		}
+	}
+	INT_EQ(runner, failures, 0, "random edits match full parse");
+
+	OK(runner, check_edit(doc, text, &len, 0, len, ""),
+	   "delete whole document");
+	OK(runner, check_edit(doc, text, &len, 0, 0, "a\n\nb\n"),
+	   "insert into empty document");
+
+	// a table of contents is rebuilt by a full reparse
+	OK(runner, check_edit(doc, text, &len, 0, 0, "{toc}\n\n# One\n\n"),
+	   "insert table of contents");
+	OK(runner, check_edit(doc, text, &len, len, 0, "\n# Two\n"),
+	   "add header to table of contents");
+	html = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	OK(runner, strstr(html, "Two</a>") != NULL, "table of contents updated");
+	free(html);
+
+	cmark_doc_free(doc);
+}
+
+static void
+repeated_edits(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"[a] and &amp; <http://x.org>\n"
+		"\n"
+		"[a]: /url \"title\"\n";
+	cmark_alloc_stats stats;
+	int enabled;
+	cmark_doc *doc = cmark_doc_new(markdown, sizeof(markdown) - 1,
+	                               CMARK_OPT_DEFAULT);
+	char *html;
+	char *expected;
+	int i;
+
+	cmark_alloc_stats_reset();
+	// each edit replaces a definition, and relinks the paragraph
+	for (i = 0; i < 5000; i++) {
+		cmark_doc_apply_edit(doc, sizeof(markdown) - 3, 0, "x", 1);
+		cmark_doc_apply_edit(doc, sizeof(markdown) - 3, 1, "", 0);
+	}
+	enabled = cmark_alloc_stats_get(&stats);
+	html = cmark_doc_render_html(doc, CMARK_OPT_DEFAULT);
+	expected = cmark_markdown_to_html(markdown, sizeof(markdown) - 1,
+	                                  CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "repeated edits: same as a full parse");
+	if (enabled) {
+		OK(runner, stats.sources[CMARK_ALLOC_CHUNKS].peak < 1024 * 1024,
+		   "repeated edits: string pool stays bounded");
+	}
+	free(html);
+	free(expected);
+	cmark_doc_free(doc);
+}
+
+static void
+deferred_shifts(test_batch_runner *runner)
+{
+	static const char *snippets[] = { "x", "\n", "\n\n", "- " };
+	char text[16384];
+	size_t len = 0;
+	size_t offset;
+	cmark_doc *doc;
+	cmark_node *expected;
+	int failures = 0;
+	int i;
+
+	for (i = 0; i < 100; i++) {
+		len += sprintf(text + len, "Paragraph %d\n\n", i);
+	}
+	doc = cmark_doc_new(text, len, CMARK_OPT_DEFAULT);
+
+	// typing at one place, with nothing read in between
+	offset = strstr(text, "Paragraph 50") - text + 9;
+	for (i = 0; i < 40; i++) {
+		failures += !apply_edit(doc, text, &len, offset++, 0,
+		                        i % 8 == 7 ? "\n" : "x");
+	}
+	OK(runner, matches_full_parse(doc, text, len),
+	   "deferred shifts: typing at one place");
+
+	// a block moved by the last edits is read, and typing goes on
+	expected = cmark_parse_document(text, len, CMARK_OPT_DEFAULT);
+	INT_EQ(runner,
+	       cmark_node_get_start_line(
+	           cmark_node_last_child(cmark_doc_get_root(doc))),
+	       cmark_node_get_start_line(cmark_node_last_child(expected)),
+	       "deferred shifts: position read between edits");
+	cmark_node_free(expected);
+	for (i = 0; i < 10; i++) {
+		failures += !apply_edit(doc, text, &len, offset++, 0, "\n");
+	}
+	OK(runner, matches_full_parse(doc, text, len),
+	   "deferred shifts: typing after a read");
+
+	// edits all over the document, more than the 64 shifts it keeps
+	for (i = 0; i < 200; i++) {
+		offset = (size_t)(i * 7919) % len;
+		failures += !apply_edit(doc, text, &len, offset, i % 3,
+		                        snippets[i % 4]);
+	}
+	OK(runner, matches_full_parse(doc, text, len),
+	   "deferred shifts: scattered edits");
+	INT_EQ(runner, failures, 0, "deferred shifts: edits applied");
+	cmark_doc_free(doc);
+}
+
+static void
+html_cache(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"{toc}\n"
+		"\n"
+		"# One\n"
+		"\n"
+		"Some [text][a].\n"
+		"\n"
+		"- item\n"
+		"- [other][a]\n"
+		"\n"
+		"Plain paragraph\n"
+		"without links.\n"
+		"\n"
+		"## Two\n"
+		"\n"
+		"    code\n"
+		"\n"
+		"[a]: /url\n";
+	cmark_doc *doc = cmark_doc_new(markdown, sizeof(markdown) - 1,
+	                               CMARK_OPT_DEFAULT);
+	cmark_html_cache *cache = cmark_html_cache_new();
+	char *expected;
+	char *html;
+	const char *edit;
+
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "first cached render");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 0,
+	       "empty cache reuses nothing");
+	free(html);
+
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "second cached render");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 6,
+	       "second render reuses all blocks but the TOC");
+	free(html);
+	free(expected);
+
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_NORMALIZE);
+	INT_EQ(runner, cmark_html_cache_reused(cache), 0,
+	       "options are part of the key");
+	free(html);
+
+	// an edit below the first line of a block reparses only that block
+	edit = strstr(markdown, "without");
+	cmark_doc_apply_edit(doc, edit - markdown, 7, "sans", 4);
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render after edit");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 0,
+	       "unused fragments are dropped");
+	free(html);
+	cmark_doc_apply_edit(doc, edit - markdown, 4, "without", 7);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	INT_EQ(runner, cmark_html_cache_reused(cache), 5,
+	       "only the edited block is rendered again");
+	free(html);
+	free(expected);
+
+	// changing a definition renders the blocks with links again, and
+	// the code block the edit reparses with the definition
+	cmark_doc_apply_edit(doc, sizeof(markdown) - 5, 3, "new", 3);
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render after changing reference");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 3,
+	       "blocks with links are rendered again");
+	free(html);
+	free(expected);
+
+	// a new header renumbers the ids of the headers after it
+	cmark_doc_apply_edit(doc, 0, 0, "# Zero\n\n", 8);
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render after adding header");
+	free(html);
+	free(expected);
+	// so does one below the TOC, to the headers after it
+	edit = strstr(markdown, "Plain");
+	cmark_doc_apply_edit(doc, 8 + (edit - markdown), 0, "## Mid\n\n", 8);
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render after adding header below TOC");
+	free(html);
+	free(expected);
+
+	// blocks moved by an edit keep their HTML, but not their sourcepos
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_SOURCEPOS);
+	free(html);
+	cmark_doc_apply_edit(doc, 0, 0, "Intro\n\n", 7);
+	expected = cmark_render_html(cmark_doc_get_root(doc),
+	                             CMARK_OPT_SOURCEPOS);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_SOURCEPOS);
+	STR_EQ(runner, html, expected, "sourcepos render after moving blocks");
+	free(html);
+	free(expected);
+
+	// the fragments of another document are not reused
+	cmark_doc_free(doc);
+	doc = cmark_doc_new(markdown, sizeof(markdown) - 1, CMARK_OPT_DEFAULT);
+	expected = cmark_render_html(cmark_doc_get_root(doc), CMARK_OPT_DEFAULT);
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "render of another document");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 0,
+	       "another document reuses nothing");
+	free(html);
+	free(expected);
+
+	cmark_html_cache_free(cache);
+	cmark_doc_free(doc);
+}
+
+static void
+retained_input(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"```c\n"
+		"int x;\n"
+		"```\n"
+		"> ~~~\n"
+		"> a\n"
+		">\tb\n"
+		"> ~~~\n"
+		"\n"
+		"    indented\n"
+		"\n"
+		"    code\n"
+		"\n"
+		"\n"
+		"<div>\n"
+		"html\n"
+		"</div>\n";
+	size_t len = sizeof(markdown) - 1;
+	cmark_parser *parser = cmark_parser_new(CMARK_OPT_RETAIN_INPUT);
+	cmark_node *doc;
+	cmark_node *node;
+	char *expected;
+	char *html;
+	size_t i;
+
+	// feed in pieces so that lines span several buffers
+	for (i = 0; i < len; i += 5) {
+		cmark_parser_feed(parser, markdown + i,
+		                  len - i < 5 ? len - i : 5);
+	}
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+
+	expected = cmark_markdown_to_html(markdown, len, CMARK_OPT_DEFAULT);
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "retained input renders the same");
+	free(html);
+	free(expected);
+
+	node = cmark_node_first_child(doc);
+	STR_EQ(runner, cmark_node_get_fence_info(node), "c",
+	       "retained input fence info");
+	STR_EQ(runner, cmark_node_get_literal(node), "int x;\n",
+	       "retained input fenced code");
+
+	node = cmark_node_first_child(cmark_node_next(node));
+	STR_EQ(runner, cmark_node_get_literal(node), "a\n  b\n",
+	       "retained input code with a tab");
+
+	node = cmark_node_next(cmark_node_parent(node));
+	STR_EQ(runner, cmark_node_get_literal(node), "indented\n\ncode\n",
+	       "retained input indented code");
+
+	// an unlinked block keeps its literal after the document is freed
+	node = cmark_node_next(node);
+	cmark_node_unlink(node);
+	cmark_node_free(doc);
+	STR_EQ(runner, cmark_node_get_literal(node), "<div>\nhtml\n</div>\n",
+	       "retained input HTML outlives its document");
+	cmark_node_free(node);
+}
+
+static void
+text_merging(test_batch_runner *runner)
+{
+	static const char markdown[] = "a b] c! d\\q ] e *f* g\n";
+	static const char braces[] = "a {b} c {#d-e} f\n";
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_DEFAULT);
+	cmark_node *para = cmark_node_first_child(doc);
+	cmark_node *text = cmark_node_first_child(para);
+
+	STR_EQ(runner, cmark_node_get_literal(text), "a b] c! d\\q ] e ",
+	       "text merging: text up to the emphasis is one node");
+	INT_EQ(runner, cmark_node_get_type(cmark_node_next(text)),
+	       CMARK_NODE_EMPH, "text merging: emphasis follows");
+	STR_EQ(runner, cmark_node_get_literal(cmark_node_last_child(para)),
+	       " g", "text merging: text after the emphasis");
+	cmark_node_free(doc);
+
+	doc = cmark_parse_document(braces, sizeof(braces) - 1, CMARK_OPT_SMART);
+	para = cmark_node_first_child(doc);
+	text = cmark_node_first_child(para);
+	INT_EQ(runner, cmark_node_get_type(text), CMARK_NODE_INLINE_LINK,
+	       "text merging: anchor comes first");
+	STR_EQ(runner, cmark_node_get_literal(text), "d-e",
+	       "text merging: anchor name");
+	STR_EQ(runner, cmark_node_get_literal(cmark_node_next(text)),
+	       "a {b} c ", "text merging: text with braces is one node");
+	STR_EQ(runner, cmark_node_get_literal(cmark_node_last_child(para)),
+	       " f", "text merging: text after the anchor");
+
+	cmark_node_free(doc);
+}
+
+static void
+pooled_strings(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"[a]: /u&amp;v 't'\n"
+		"\n"
+		"[a], [b](/x\\*y \"t&amp;\"), <http://e.com/?a&amp;b>, &copy; and [a]\n";
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_DEFAULT);
+	cmark_node *para = cmark_node_first_child(doc);
+	cmark_node *links[4];
+	cmark_node *entity = NULL;
+	cmark_node *node;
+	int n = 0;
+
+	for (node = cmark_node_first_child(para); node;
+	     node = cmark_node_next(node)) {
+		if (cmark_node_get_type(node) == CMARK_NODE_LINK && n < 4) {
+			links[n++] = node;
+		} else if (cmark_node_get_type(node) == CMARK_NODE_TEXT &&
+		           strcmp(cmark_node_get_literal(node), "\xc2\xa9") == 0) {
+			entity = node;
+		}
+	}
+	INT_EQ(runner, n, 4, "pooled strings: four links");
+	OK(runner, entity != NULL, "pooled strings: entity");
+	if (n < 4 || entity == NULL) {
+		cmark_node_free(doc);
+		return;
+	}
+
+	// unlinked inlines keep their strings after the document is freed
+	for (n = 0; n < 4; n++) {
+		cmark_node_unlink(links[n]);
+	}
+	cmark_node_unlink(entity);
+	cmark_node_free(doc);
+
+	STR_EQ(runner, cmark_node_get_url(links[0]), "/u&v",
+	       "pooled strings: reference url");
+	STR_EQ(runner, cmark_node_get_title(links[0]), "t",
+	       "pooled strings: reference title");
+	STR_EQ(runner, cmark_node_get_url(links[1]), "/x*y",
+	       "pooled strings: inline url");
+	STR_EQ(runner, cmark_node_get_title(links[1]), "t&",
+	       "pooled strings: inline title");
+	STR_EQ(runner, cmark_node_get_url(links[2]), "http://e.com/?a&b",
+	       "pooled strings: autolink");
+	STR_EQ(runner, cmark_node_get_url(links[3]), "/u&v",
+	       "pooled strings: second use of a reference");
+	STR_EQ(runner, cmark_node_get_literal(cmark_node_first_child(links[3])),
+	       "a", "pooled strings: link text");
+	STR_EQ(runner, cmark_node_get_literal(entity), "\xc2\xa9",
+	       "pooled strings: entity text");
+
+	for (n = 0; n < 4; n++) {
+		cmark_node_free(links[n]);
+	}
+	cmark_node_free(entity);
+}
+
+static void
+lazy_inlines(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"# *Title*\n"
+		"\n"
+		"See [ref] and `code`.\n"
+		"\n"
+		"> quoted [ref]\n"
+		"\n"
+		"[ref]: /url\n";
+	cmark_node *eager = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                         CMARK_OPT_DEFAULT);
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_LAZY_INLINES);
+	cmark_node *header = cmark_node_first_child(doc);
+	cmark_node *para = cmark_node_next(header);
+	cmark_node *link;
+	char *expected = cmark_render_html(eager, CMARK_OPT_DEFAULT);
+	char *html;
+
+	link = cmark_node_next(cmark_node_first_child(para));
+	INT_EQ(runner, cmark_node_get_type(link), CMARK_NODE_LINK,
+	       "lazy inlines: first_child parses the paragraph");
+	STR_EQ(runner, cmark_node_get_url(link), "/url",
+	       "lazy inlines: reference defined after its use");
+
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, expected, "lazy inlines: same html as eager");
+	free(html);
+	cmark_node_free(doc);
+
+	// a paragraph unlinked before its inlines were looked at keeps them
+	doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                           CMARK_OPT_LAZY_INLINES);
+	para = cmark_node_next(cmark_node_first_child(doc));
+	cmark_node_unlink(para);
+	cmark_node_free(doc);
+	link = cmark_node_next(cmark_node_first_child(para));
+	STR_EQ(runner, cmark_node_get_url(link), "/url",
+	       "lazy inlines: unlinked paragraph");
+	cmark_node_free(para);
+
+	free(expected);
+	cmark_node_free(eager);
+}
+
+static void
+blocks_only(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"# Head *x*\n"
+		"\n"
+		"[ref]: /u\n"
+		"Some `code` and [ref]\n"
+		"more\n"
+		"\n"
+		"```c\n"
+		"int x;\n"
+		"```\n";
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_BLOCKS_ONLY);
+	cmark_node *header = cmark_node_first_child(doc);
+	cmark_node *para = cmark_node_next(header);
+	cmark_node *code = cmark_node_next(para);
+
+	OK(runner, cmark_node_first_child(header) == NULL,
+	   "blocks only: header has no inlines");
+	STR_EQ(runner, cmark_node_get_content(header), "Head *x*",
+	       "blocks only: header content");
+	OK(runner, cmark_node_first_child(para) == NULL,
+	   "blocks only: paragraph has no inlines");
+	STR_EQ(runner, cmark_node_get_content(para),
+	       "Some `code` and [ref]\nmore\n",
+	       "blocks only: paragraph content without the definition");
+	STR_EQ(runner, cmark_node_get_fence_info(code), "c",
+	       "blocks only: fence info");
+	OK(runner, cmark_node_get_content(code) == NULL,
+	   "blocks only: no content for code blocks");
+
+	INT_EQ(runner, cmark_node_get_start_offset(header), 0,
+	       "blocks only: header start offset");
+	INT_EQ(runner, cmark_node_get_end_offset(header), 11,
+	       "blocks only: header end offset");
+	INT_EQ(runner, cmark_node_get_start_offset(para), 12,
+	       "blocks only: paragraph start offset");
+	INT_EQ(runner, cmark_node_get_end_offset(para), 49,
+	       "blocks only: paragraph end offset");
+	INT_EQ(runner, cmark_node_get_start_offset(code), 50,
+	       "blocks only: code block start offset");
+	INT_EQ(runner, cmark_node_get_end_offset(code),
+	       (int)sizeof(markdown) - 1, "blocks only: code block end offset");
+
+	cmark_node_free(doc);
+}
+
+static void
+html_preview(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"# Title\n"
+		"\n"
+		"- one\n"
+		"- two *three\n"
+		"  four*\n"
+		"\n"
+		"> quote\n"
+		"\n"
+		"[ref]\n"
+		"\n"
+		"[ref]: /url\n";
+	cmark_node *doc;
+	cmark_node *list;
+	char *html;
+
+	html = cmark_markdown_to_html_preview(markdown, sizeof(markdown) - 1,
+	                                      CMARK_OPT_DEFAULT, 2, 0);
+	STR_EQ(runner, html,
+	       "<h1>Title</h1>\n"
+	       "<ul>\n"
+	       "<li>one</li>\n"
+	       "<li>two <em>three\n"
+	       "four</em></li>\n"
+	       "</ul>\n",
+	       "html preview: first two blocks");
+	free(html);
+
+	html = cmark_markdown_to_html_preview(markdown, sizeof(markdown) - 1,
+	                                      CMARK_OPT_DEFAULT, 0, 36);
+	STR_EQ(runner, html,
+	       "<h1>Title</h1>\n"
+	       "<ul>\n"
+	       "<li>one</li>\n"
+	       "<li>t</li>\n"
+	       "</ul>\n",
+	       "html preview: open elements are closed");
+	free(html);
+
+	html = cmark_markdown_to_html_preview(markdown, sizeof(markdown) - 1,
+	                                      CMARK_OPT_DEFAULT, 0, 0);
+	STR_EQ(runner, html + strlen(html) - 30,
+	       "<p><a href=\"/url\">ref</a></p>\n",
+	       "html preview: no limits");
+	free(html);
+
+	doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                           CMARK_OPT_DEFAULT);
+	html = cmark_render_html_truncated(doc, CMARK_OPT_DEFAULT, 1, 0);
+	STR_EQ(runner, html, "<h1>Title</h1>\n",
+	       "html preview: truncated render");
+	free(html);
+	list = cmark_node_next(cmark_node_first_child(doc));
+	html = cmark_render_html_truncated(list, CMARK_OPT_DEFAULT, 0, 1);
+	STR_EQ(runner, html, "<ul>\n<li>o</li>\n</ul>\n",
+	       "html preview: truncated render of a subtree");
+	free(html);
+	cmark_node_free(doc);
+}
+
+static void
+html_preview_huge_block(test_batch_runner *runner)
+{
+	static const char line[] = "code line\n";
+	size_t size = 1 << 20;
+	char *markdown = (char *)malloc(size);
+	char *html;
+	size_t i;
+
+	// one line of two-byte characters
+	for (i = 0; i < size; i += 2) {
+		markdown[i] = '\xc3';
+		markdown[i + 1] = '\xa9';
+	}
+	html = cmark_markdown_to_html_preview(markdown, size, CMARK_OPT_DEFAULT,
+	                                      0, 100);
+	INT_EQ(runner, (int)strlen(html), 3 + 96 + 5,
+	       "html preview: one huge paragraph is cut at max_bytes");
+	OK(runner, strncmp(html, "<p>\xc3\xa9", 5) == 0 &&
+	   strcmp(html + strlen(html) - 7, "\xc3\xa9</p>\n") == 0,
+	   "html preview: the paragraph is cut between characters");
+	free(html);
+
+	memcpy(markdown, "```\n", 4);
+	for (i = 4; i + sizeof(line) - 1 <= size; i += sizeof(line) - 1) {
+		memcpy(markdown + i, line, sizeof(line) - 1);
+	}
+	html = cmark_markdown_to_html_preview(markdown, i, CMARK_OPT_DEFAULT,
+	                                      1, 100);
+	OK(runner, strlen(html) < 200,
+	   "html preview: an unclosed fence is cut at max_bytes");
+	OK(runner, strncmp(html, "<pre><code>code line\n", 21) == 0 &&
+	   strcmp(html + strlen(html) - 14, "</code></pre>\n") == 0,
+	   "html preview: the cut fence is closed");
+	free(html);
+	free(markdown);
+}
+
+static void
+parser_stats(test_batch_runner *runner)
+{
+	static const char markdown[] =
+		"# Header\n"
+		"\n"
+		"Some *emphasis* and a [link](/url).\n"
+		"\n"
+		"- item\n"
+		"- item\n";
+	cmark_parser_stats stats;
+	cmark_parser *parser;
+	cmark_node *doc;
+	uint64_t inlines_ns;
+	char *html;
+	int i;
+
+	memset(&stats, 0, sizeof(stats));
+	parser = cmark_parser_new(CMARK_OPT_DEFAULT);
+	cmark_parser_set_stats(parser, &stats);
+	for (i = 0; i < 100; i++) {
+		cmark_parser_feed(parser, markdown, sizeof(markdown) - 1);
+	}
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+	OK(runner, stats.lines_ns > 0, "parser stats: lines");
+	OK(runner, stats.finalize_ns > 0, "parser stats: finalize");
+	OK(runner, stats.inlines_ns > 0, "parser stats: inlines");
+	OK(runner, stats.render_ns == 0, "parser stats: no render yet");
+	INT_EQ(runner, (int)stats.bytes, 100 * ((int)sizeof(markdown) - 1),
+	       "parser stats: bytes");
+	INT_EQ(runner, (int)stats.lines, 600, "parser stats: lines");
+	INT_EQ(runner, (int)stats.nodes[CMARK_NODE_HEADER], 100,
+	       "parser stats: headers");
+	INT_EQ(runner, (int)stats.nodes[CMARK_NODE_EMPH], 100,
+	       "parser stats: emphasis");
+	INT_EQ(runner, (int)stats.nodes[CMARK_NODE_LINK], 100,
+	       "parser stats: links");
+	INT_EQ(runner, (int)stats.delimiters, 300,
+	       "parser stats: delimiters");
+	OK(runner, stats.peak_content > 0, "parser stats: peak content");
+
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	free(html);
+	OK(runner, stats.render_ns > 0, "parser stats: render");
+	cmark_node_free(doc);
+	OK(runner, stats.free_ns > 0, "parser stats: free");
+
+	// inlines parsed during a render count as inline parsing
+	memset(&stats, 0, sizeof(stats));
+	parser = cmark_parser_new(CMARK_OPT_LAZY_INLINES);
+	cmark_parser_set_stats(parser, &stats);
+	for (i = 0; i < 100; i++) {
+		cmark_parser_feed(parser, markdown, sizeof(markdown) - 1);
+	}
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+	inlines_ns = stats.inlines_ns;
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	free(html);
+	OK(runner, stats.inlines_ns > inlines_ns, "parser stats: lazy inlines");
+	INT_EQ(runner, (int)stats.nodes[CMARK_NODE_EMPH], 100,
+	       "parser stats: emphasis parsed lazily");
+	cmark_node_free(doc);
+}
+
+static void
+alloc_stats(test_batch_runner *runner)
+{
+	static const char markdown[] = "# Title {#top}\n\n- *a*\n- b\n";
+	cmark_alloc_stats stats;
+	int enabled = cmark_alloc_stats_get(&stats);
+	size_t live = stats.total.live;
+
+	cmark_alloc_stats_reset();
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_DEFAULT);
+	char *html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	cmark_free(html);
+	cmark_node_free(doc);
+
+	OK(runner, cmark_alloc_stats_get(&stats) == enabled,
+	   "alloc stats availability doesn't change");
+	if (!enabled) {
+		INT_EQ(runner, (int)stats.total.allocs, 0,
+		       "no allocations counted without CMARK_ALLOC_STATS");
+		return;
+	}
+	OK(runner, stats.total.allocs > 0, "allocations counted");
+	OK(runner, stats.sources[CMARK_ALLOC_NODES].allocs > 0,
+	   "node allocations counted");
+	OK(runner, stats.sources[CMARK_ALLOC_STRBUF].allocs > 0,
+	   "strbuf allocations counted");
+	OK(runner, stats.total.peak >= stats.sources[CMARK_ALLOC_NODES].peak,
+	   "total peak covers node peak");
+	// blocks that earlier tests freed with free() may be reused and
+	// no longer counted
+	OK(runner, stats.total.live <= live, "everything freed");
+}
+
+typedef struct {
+	cmark_trace_event events[16];
+	int count;
+} trace_log;
+
+static void
+trace_record(const cmark_trace_event *event, void *data)
+{
+	trace_log *log = (trace_log *)data;
+
+	if (log->count < 16) {
+		log->events[log->count] = *event;
+	}
+	log->count++;
+}
+
+static void
+trace_callback(test_batch_runner *runner)
+{
+	static const char markdown[] = "# Title\n\ntext\n";
+	static const cmark_trace_stage stages[] = {
+		CMARK_TRACE_LINES, CMARK_TRACE_INLINES,
+		CMARK_TRACE_POSTPROCESS, CMARK_TRACE_RENDER, CMARK_TRACE_FREE
+	};
+	trace_log log;
+	int i;
+
+	memset(&log, 0, sizeof(log));
+	if (!cmark_set_trace_callback(trace_record, &log)) {
+		char *html = cmark_markdown_to_html(markdown,
+		                                    sizeof(markdown) - 1,
+		                                    CMARK_OPT_DEFAULT);
+		free(html);
+		INT_EQ(runner, log.count, 0,
+		       "no trace events without CMARK_TRACE");
+		return;
+	}
+
+	cmark_node *doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                                       CMARK_OPT_DEFAULT);
+	char *html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	free(html);
+	cmark_node_free(doc);
+	cmark_set_trace_callback(NULL, NULL);
+
+	INT_EQ(runner, log.count, 10, "a begin and an end per stage");
+	for (i = 0; i < log.count && i < 10; i++) {
+		INT_EQ(runner, log.events[i].stage, stages[i / 2],
+		       "stage of event %d", i);
+		INT_EQ(runner, log.events[i].end, i % 2, "end of event %d", i);
+		OK(runner, log.events[i].document == log.events[0].document,
+		   "document of event %d", i);
+	}
+	OK(runner, log.events[0].document != 0, "documents are numbered");
+	INT_EQ(runner, (int)log.events[0].offset, 0, "lines begin at 0");
+	INT_EQ(runner, (int)log.events[1].offset, (int)sizeof(markdown) - 1,
+	       "lines end at the end of the input");
+	OK(runner, log.events[0].stats == NULL, "no stats attached");
+
+	doc = cmark_parse_document(markdown, sizeof(markdown) - 1,
+	                           CMARK_OPT_DEFAULT);
+	log.count = 0;
+	cmark_node_free(doc);
+	INT_EQ(runner, log.count, 0, "no events once the callback is unset");
+}
+
+static void
+anchors(test_batch_runner *runner)
+{
+	static const struct {
+		const char *markdown;
+		const char *html;
+	} cases[] = {
+		{ "a {#sec-3} b", "<p><a name = \"sec-3\"></a>a  b</p>\n" },
+		{ "a {#x *y*} b", "<p><a name = \"x *y*\"></a>a  b</p>\n" },
+		{ "a {#x} }", "<p><a name = \"x\"></a>a  }</p>\n" },
+		{ "a {#} b", "<p>a {#} b</p>\n" },
+	};
+	size_t i;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		char *html = cmark_markdown_to_html(cases[i].markdown,
+		                                    strlen(cases[i].markdown),
+		                                    CMARK_OPT_SMART);
+		STR_EQ(runner, html, cases[i].html, "anchor %s",
+		       cases[i].markdown);
+		free(html);
+	}
+}
+
+// Parses 'markdown' within 'limits' and renders it to HTML.
+static char *
+S_limited_html(const char *markdown, cmark_limits *limits)
+{
+	cmark_parser *parser = cmark_parser_new(CMARK_OPT_DEFAULT);
+	cmark_node *doc;
+	char *html;
+
+	limits->exceeded = 0;
+	cmark_parser_set_limits(parser, limits);
+	cmark_parser_feed(parser, markdown, strlen(markdown));
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+	html = cmark_render_html(doc, CMARK_OPT_DEFAULT);
+	cmark_node_free(doc);
+	return html;
+}
+
+static void
+limits(test_batch_runner *runner)
+{
+	cmark_limits lim;
+	static const char para[] = "*a*\n\n";
+	char long_doc[1000 * (sizeof(para) - 1) + 1];
+	char *html;
+	int i;
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_depth = 3;
+	html = S_limited_html("> > > > > a\n> b\n", &lim);
+	STR_EQ(runner, html,
+	       "<blockquote>\n<blockquote>\n<blockquote>\n"
+	       "<p>&gt; &gt; a\nb</p>\n"
+	       "</blockquote>\n</blockquote>\n</blockquote>\n",
+	       "blocks past max_depth are text");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_DEPTH,
+	       "max_depth exceeded");
+	free(html);
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_nodes = 4;
+	html = S_limited_html("# a\n\nb *c*\n\n- d\n- e\n", &lim);
+	STR_EQ(runner, html,
+	       "<h1>a</h1>\n<p>b *c*</p>\n<ul>\n<li>d</li>\n</ul>\n"
+	       "<p>- e</p>\n",
+	       "input past max_nodes is text");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_NODES,
+	       "max_nodes exceeded");
+	free(html);
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_nodes = 6;
+	html = S_limited_html("a *b* c *d* e\n", &lim);
+	STR_EQ(runner, html, "<p>a <em>b</em> c *d* e</p>\n",
+	       "inlines past max_nodes are text");
+	free(html);
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_delimiters = 2;
+	html = S_limited_html("*a* *b* [c](d)\n", &lim);
+	STR_EQ(runner, html, "<p><em>a</em> *b* [c](d)</p>\n",
+	       "delimiters past max_delimiters are text");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_DELIMITERS,
+	       "max_delimiters exceeded");
+	free(html);
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_output = 20;
+	html = S_limited_html("> a\n>\n> b\n\nc\n", &lim);
+	STR_EQ(runner, html, "<blockquote>\n<p>a</p>\n</blockquote>\n",
+	       "render stops at max_output and closes elements");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_OUTPUT,
+	       "max_output exceeded");
+	free(html);
+
+	for (i = 0; i < 1000; i++) {
+		memcpy(long_doc + i * (sizeof(para) - 1), para, sizeof(para));
+	}
+	memset(&lim, 0, sizeof(lim));
+	lim.max_ns = 1;
+	html = S_limited_html(long_doc, &lim);
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_TIME, "max_ns exceeded");
+	OK(runner, strlen(html) < 1000 * strlen("<p><em>a</em></p>\n"),
+	   "render stops after max_ns");
+	free(html);
+
+	memset(&lim, 0, sizeof(lim));
+	html = S_limited_html("> *a*\n", &lim);
+	STR_EQ(runner, html, "<blockquote>\n<p><em>a</em></p>\n</blockquote>\n",
+	       "no limits");
+	INT_EQ(runner, lim.exceeded, 0, "no limit exceeded");
+	free(html);
+}
+
+static void
+doc_limits(test_batch_runner *runner)
+{
+	static const char markdown[] = "# a\n\nb\n\n> c\n\nd\n";
+	cmark_limits lim;
+	cmark_html_cache *cache = cmark_html_cache_new();
+	cmark_doc *doc;
+	char *html;
+
+	memset(&lim, 0, sizeof(lim));
+	lim.max_nodes = 20;
+	doc = cmark_doc_new_with_limits(markdown, sizeof(markdown) - 1,
+	                                CMARK_OPT_DEFAULT, &lim);
+	INT_EQ(runner, lim.exceeded, 0, "doc within max_nodes");
+
+	OK(runner, cmark_doc_apply_edit(doc, 5, 1,
+	                                "*1* *2* *3* *4* *5* *6* *7* *8*", 31),
+	   "doc edit past max_nodes");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_NODES,
+	       "doc edit counts its nodes against max_nodes");
+	html = cmark_doc_render_html(doc, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html,
+	       "<h1>a</h1>\n<p><em>1</em> <em>2</em> <em>3</em> <em>4</em> "
+	       "*5* *6* *7* *8*</p>\n"
+	       "<blockquote>\n<p>c</p>\n</blockquote>\n<p>d</p>\n",
+	       "doc edit stops at max_nodes");
+	free(html);
+
+	OK(runner, cmark_doc_apply_edit(doc, 5, 31, "e", 1), "doc edit back");
+	INT_EQ(runner, lim.exceeded, 0, "each doc edit starts over");
+
+	lim.max_output = 30;
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html, "<h1>a</h1>\n<p>e</p>\n<blockquote>\n</blockquote>\n",
+	       "cached doc render stops at max_output and closes elements");
+	INT_EQ(runner, lim.exceeded, CMARK_LIMIT_OUTPUT,
+	       "cached doc render max_output exceeded");
+	free(html);
+
+	lim.max_output = 0;
+	html = cmark_doc_render_html_cached(doc, cache, CMARK_OPT_DEFAULT);
+	STR_EQ(runner, html,
+	       "<h1>a</h1>\n<p>e</p>\n<blockquote>\n<p>c</p>\n</blockquote>\n"
+	       "<p>d</p>\n",
+	       "truncated blocks are not cached");
+	INT_EQ(runner, cmark_html_cache_reused(cache), 2,
+	       "complete blocks are cached");
+	INT_EQ(runner, lim.exceeded, 0, "each doc render starts over");
+	free(html);
+
+	cmark_html_cache_free(cache);
+	cmark_doc_free(doc);
+}
+
+static void
+render_batch(test_batch_runner *runner)
+{
+	static const char *inputs[] = {
+		"[foo]: /url \"title\"\n\n[foo]\n",
+		"[foo]\n",
+		"",
+		"# Header\n\n- a\n- b *c*\n\n> quote\n",
+		"<div>\nhtml\n</div>\n",
+		"    code\n\n```\nfenced\n```",
+		"a {#anchor} \"b\" -- c...",
+		"Setext\n======\n\n***\n\n1. one\n2. two",
+		"{toc}\n\n# One\n\n## Two\n",
+		"<<style.css>>\n\ntext\n",
+		"after *a head*\n",
+	};
+	static const int options[] = {
+		CMARK_OPT_DEFAULT,
+		CMARK_OPT_SOURCEPOS | CMARK_OPT_SMART,
+		CMARK_OPT_LAZY_INLINES | CMARK_OPT_NORMALIZE,
+	};
+	static const int threads[] = { 1, 3, 100 };
+	const size_t n = sizeof(inputs) / sizeof(inputs[0]);
+	size_t lens[sizeof(inputs) / sizeof(inputs[0])];
+	size_t offsets[sizeof(inputs) / sizeof(inputs[0]) + 1];
+	size_t i, o, t;
+	char *out;
+
+	for (i = 0; i < n; i++) {
+		lens[i] = strlen(inputs[i]);
+	}
+	for (o = 0; o < sizeof(options) / sizeof(options[0]); o++) {
+		for (t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+			int ok = cmark_render_batch(inputs, lens, n, options[o],
+			                            offsets, &out, threads[t]);
+
+			INT_EQ(runner, ok, 1, "batch with options %d, %d threads",
+			       options[o], threads[t]);
+			for (i = 0; i < n; i++) {
+				char *html = cmark_markdown_to_html(inputs[i],
+				                                    lens[i],
+				                                    options[o]);
+				char *part = (char *)malloc(offsets[i + 1] -
+				                            offsets[i] + 1);
+
+				memcpy(part, out + offsets[i],
+				       offsets[i + 1] - offsets[i]);
+				part[offsets[i + 1] - offsets[i]] = '\0';
+				STR_EQ(runner, part, html,
+				       "batch document %d, options %d, %d threads",
+				       (int)i, options[o], threads[t]);
+				free(part);
+				free(html);
+			}
+			INT_EQ(runner, (int)strlen(out), (int)offsets[n],
+			       "batch output ends at the last offset");
+			cmark_free(out);
+		}
+	}
+
+	INT_EQ(runner, cmark_render_batch(NULL, NULL, 0, CMARK_OPT_DEFAULT,
+	                                  offsets, &out, 4), 1,
+	       "empty batch");
+	STR_EQ(runner, out, "", "empty batch output");
+	INT_EQ(runner, (int)offsets[0], 0, "empty batch offset");
+	cmark_free(out);
+}
+
 static void
 utf8(test_batch_runner *runner)
 {
@@ -723,6 +1961,25 @@ int main() {
 	hierarchy(runner);
 	parser(runner);
 	render_html(runner);
+	binary_serialization(runner);
+	incremental_parsing(runner);
+	repeated_edits(runner);
+	deferred_shifts(runner);
+	html_cache(runner);
+	retained_input(runner);
+	text_merging(runner);
+	pooled_strings(runner);
+	lazy_inlines(runner);
+	blocks_only(runner);
+	html_preview(runner);
+	html_preview_huge_block(runner);
+	parser_stats(runner);
+	alloc_stats(runner);
+	trace_callback(runner);
+	anchors(runner);
+	limits(runner);
+	doc_limits(runner);
+	render_batch(runner);
 	utf8(runner);
 	numeric_entities(runner);
 	test_cplusplus(runner);
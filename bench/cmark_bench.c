@@ -0,0 +1,520 @@
+// for clock_gettime() when compiling as C99
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmark.h"
+
+// Times each stage of the processing of a document in-process, with
+// the monotonic clock of the parser statistics, so that neither
+// process startup nor I/O is measured.  Every run parses and renders
+// the input afresh; the first few runs only warm the caches and the
+// allocator.
+//
+// With --memory it instead reports the heap used to parse and render
+// each document with each output format and option, as counted by a
+// library built with CMARK_ALLOC_STATS.
+//
+// With --batch BYTES it instead splits each file into documents of
+// about BYTES bytes, at blank lines, and times converting them one by
+// one with cmark_markdown_to_html against cmark_render_batch.
+
+typedef enum {
+	STAGE_BLOCKS,
+	STAGE_INLINES,
+	STAGE_POSTPROCESS,
+	STAGE_PARSE,
+	STAGE_HTML,
+	STAGE_XML,
+	STAGE_MAN,
+	STAGE_COMMONMARK,
+	STAGE_FREE,
+	NUM_STAGES
+} stage;
+
+static const char *stage_names[NUM_STAGES] = {
+	"blocks", "inlines", "postprocess", "parse",
+	"html", "xml", "man", "commonmark", "free"
+};
+
+static const char *source_names[CMARK_ALLOC_NUM_SOURCES] = {
+	"nodes", "strbuf", "chunks", "refmap", "other"
+};
+
+static const struct {
+	const char *name;
+	int options;
+} memory_options[] = {
+	{ "default", CMARK_OPT_DEFAULT },
+	{ "smart", CMARK_OPT_SMART },
+	{ "normalize", CMARK_OPT_NORMALIZE },
+	{ "sourcepos", CMARK_OPT_SOURCEPOS },
+};
+
+static void print_usage()
+{
+	printf("Usage:   cmark_bench [OPTIONS] FILE+\n");
+	printf("Options:\n");
+	printf("  --runs N     Number of measured runs (default 10)\n");
+	printf("  --warmup N   Number of runs before measuring (default 2)\n");
+	printf("  --smart      Use smart punctuation\n");
+	printf("  --memory     Report heap allocations instead of time\n");
+	printf("  --batch N    Time converting documents of about N bytes "
+	       "in a batch\n");
+	printf("  --threads N  Threads of the batch (default 1)\n");
+	printf("  --json       Print the results as JSON, a line per file\n");
+	printf("  --help, -h   Print usage information\n");
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	char *buf = NULL;
+	size_t size = 0, n;
+	char chunk[65536];
+
+	if (f == NULL) {
+		return NULL;
+	}
+	while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+		char *p = (char *)realloc(buf, size + n);
+		if (p == NULL) {
+			free(buf);
+			fclose(f);
+			return NULL;
+		}
+		buf = p;
+		memcpy(buf + size, chunk, n);
+		size += n;
+	}
+	fclose(f);
+	*len = size;
+	return buf;
+}
+
+static char *render_stage(cmark_node *document, stage which, int options)
+{
+	switch (which) {
+	case STAGE_HTML:
+		return cmark_render_html(document, options);
+	case STAGE_XML:
+		return cmark_render_xml(document, options);
+	case STAGE_MAN:
+		return cmark_render_man(document, options);
+	case STAGE_COMMONMARK:
+		return cmark_render_commonmark(document, options, 0);
+	default:
+		return NULL;
+	}
+}
+
+static uint64_t render(cmark_node *document, cmark_parser_stats *stats,
+                       stage which, int options)
+{
+	uint64_t before = stats->render_ns;
+
+	cmark_free(render_stage(document, which, options));
+	return stats->render_ns - before;
+}
+
+// Runs every stage once, storing the time of each in 'times' and
+// the number of nodes parsed in 'nodes'.
+static void run(const char *text, size_t len, int options,
+                uint64_t times[NUM_STAGES], uint64_t *nodes)
+{
+	cmark_parser_stats stats;
+	cmark_parser *parser;
+	cmark_node *document;
+	int type;
+	int i;
+
+	memset(&stats, 0, sizeof(stats));
+	parser = cmark_parser_new(options);
+	cmark_parser_set_stats(parser, &stats);
+	cmark_parser_feed(parser, text, len);
+	document = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+
+	times[STAGE_BLOCKS] = stats.lines_ns + stats.finalize_ns;
+	times[STAGE_INLINES] = stats.inlines_ns;
+	times[STAGE_POSTPROCESS] = stats.postprocess_ns;
+	times[STAGE_PARSE] = times[STAGE_BLOCKS] + times[STAGE_INLINES] +
+	                     times[STAGE_POSTPROCESS];
+	for (i = STAGE_HTML; i <= STAGE_COMMONMARK; i++) {
+		times[i] = render(document, &stats, (stage)i, options);
+	}
+	cmark_node_free(document);
+	times[STAGE_FREE] = stats.free_ns;
+
+	*nodes = 0;
+	for (type = 0; type <= CMARK_NODE_LAST_INLINE; type++) {
+		*nodes += stats.nodes[type];
+	}
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+// Sorts 'values' in place.
+static double median(uint64_t *values, int n)
+{
+	qsort(values, n, sizeof(*values), compare_u64);
+	return n % 2 ? (double)values[n / 2]
+	       : ((double)values[n / 2 - 1] + (double)values[n / 2]) / 2;
+}
+
+// Median absolute deviation from 'mid'.
+static double mad(const uint64_t *values, int n, double mid)
+{
+	uint64_t *dev = (uint64_t *)malloc(n * sizeof(*dev));
+	double result;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		double d = (double)values[i] - mid;
+		dev[i] = (uint64_t)(d < 0 ? -d : d);
+	}
+	result = median(dev, n);
+	free(dev);
+	return result;
+}
+
+static void print_json_string(const char *str)
+{
+	putchar('"');
+	for (; *str; str++) {
+		if (*str == '"' || *str == '\\') {
+			putchar('\\');
+		}
+		putchar(*str);
+	}
+	putchar('"');
+}
+
+static void bench_time(const char *path, const char *text, size_t len,
+                       int options, int runs, int warmup, int json)
+{
+	uint64_t *times;
+	uint64_t run_times[NUM_STAGES];
+	uint64_t nodes = 0;
+	int i, s;
+
+	times = (uint64_t *)malloc(sizeof(*times) * NUM_STAGES * runs);
+	for (i = 0; i < warmup; i++) {
+		run(text, len, options, run_times, &nodes);
+	}
+	for (i = 0; i < runs; i++) {
+		run(text, len, options, run_times, &nodes);
+		for (s = 0; s < NUM_STAGES; s++) {
+			times[s * runs + i] = run_times[s];
+		}
+	}
+
+	if (json) {
+		printf("{\"file\": ");
+		print_json_string(path);
+		printf(", \"bytes\": %llu, \"nodes\": %llu, \"runs\": %d, "
+		       "\"stages\": {", (unsigned long long)len,
+		       (unsigned long long)nodes, runs);
+	} else {
+		printf("%s: %llu bytes, %llu nodes, %d runs\n", path,
+		       (unsigned long long)len, (unsigned long long)nodes, runs);
+		printf("%-12s %14s %12s %10s %9s\n", "stage", "median_ns",
+		       "mad_ns", "MB/s", "ns/node");
+	}
+	for (s = 0; s < NUM_STAGES; s++) {
+		uint64_t *values = times + s * runs;
+		double mid = median(values, runs);
+		double dev = mad(values, runs, mid);
+		// bytes per nanosecond are GB/s
+		double mbps = mid > 0 ? (double)len / mid * 1000 : 0;
+		double per_node = nodes > 0 ? mid / (double)nodes : 0;
+
+		if (json) {
+			printf("%s\"%s\": {\"median_ns\": %.0f, \"mad_ns\": %.0f, "
+			       "\"mb_per_s\": %.2f, \"ns_per_node\": %.2f}",
+			       s ? ", " : "", stage_names[s], mid, dev, mbps,
+			       per_node);
+		} else {
+			printf("%-12s %14.0f %12.0f %10.2f %9.2f\n", stage_names[s],
+			       mid, dev, mbps, per_node);
+		}
+	}
+	if (json) {
+		printf("}}\n");
+	}
+	free(times);
+}
+
+// Parses and renders 'text' with every option and format, printing
+// the peak heap, the number of allocations and the bytes allocated,
+// in total and by source.
+static int bench_memory(const char *path, const char *text, size_t len,
+                        int json)
+{
+	size_t num_options = sizeof(memory_options) / sizeof(*memory_options);
+	cmark_alloc_stats stats;
+	cmark_node *document;
+	size_t o;
+	int s, src;
+
+	if (!cmark_alloc_stats_get(&stats)) {
+		fprintf(stderr, "cmark_bench: --memory needs a library built "
+		        "with -DCMARK_ALLOC_STATS=ON\n");
+		return 0;
+	}
+
+	if (json) {
+		printf("{\"file\": ");
+		print_json_string(path);
+		printf(", \"bytes\": %llu, \"runs\": [", (unsigned long long)len);
+	} else {
+		printf("%s: %llu bytes\n", path, (unsigned long long)len);
+		printf("%-10s %-10s %12s %9s %12s", "options", "format", "peak",
+		       "allocs", "bytes");
+		for (src = 0; src < CMARK_ALLOC_NUM_SOURCES; src++) {
+			printf(" %10s", source_names[src]);
+		}
+		printf("\n");
+	}
+	for (o = 0; o < num_options; o++) {
+		for (s = STAGE_HTML; s <= STAGE_COMMONMARK; s++) {
+			cmark_alloc_stats_reset();
+			document = cmark_parse_document(text, len,
+			                                memory_options[o].options);
+			cmark_free(render_stage(document, (stage)s,
+			                        memory_options[o].options));
+			cmark_node_free(document);
+			cmark_alloc_stats_get(&stats);
+
+			if (json) {
+				printf("%s{\"options\": \"%s\", \"format\": \"%s\", "
+				       "\"peak\": %llu, \"allocs\": %llu, "
+				       "\"bytes\": %llu, \"sources\": {",
+				       o || s != STAGE_HTML ? ", " : "",
+				       memory_options[o].name, stage_names[s],
+				       (unsigned long long)stats.total.peak,
+				       (unsigned long long)stats.total.allocs,
+				       (unsigned long long)stats.total.bytes);
+				for (src = 0; src < CMARK_ALLOC_NUM_SOURCES; src++) {
+					cmark_alloc_counts *c = &stats.sources[src];
+					printf("%s\"%s\": {\"peak\": %llu, "
+					       "\"allocs\": %llu, \"bytes\": %llu}",
+					       src ? ", " : "", source_names[src],
+					       (unsigned long long)c->peak,
+					       (unsigned long long)c->allocs,
+					       (unsigned long long)c->bytes);
+				}
+				printf("}}");
+			} else {
+				printf("%-10s %-10s %12llu %9llu %12llu",
+				       memory_options[o].name, stage_names[s],
+				       (unsigned long long)stats.total.peak,
+				       (unsigned long long)stats.total.allocs,
+				       (unsigned long long)stats.total.bytes);
+				// the peak of each source, which need not be
+				// reached at the same time as the total peak
+				for (src = 0; src < CMARK_ALLOC_NUM_SOURCES; src++) {
+					printf(" %10llu", (unsigned long long)
+					       stats.sources[src].peak);
+				}
+				printf("\n");
+			}
+		}
+	}
+	if (json) {
+		printf("]}\n");
+	}
+	return 1;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+// Splits 'text' into documents of at least 'size' bytes that end at a
+// blank line, or at the end of the text.  Returns their number.
+static size_t split_documents(const char *text, size_t len, size_t size,
+                              const char **inputs, size_t *lens)
+{
+	const char *p = text, *end = text + len;
+	size_t n = 0;
+
+	while (p < end) {
+		const char *q = p + size < end ? p + size : end;
+		const char *blank = NULL;
+
+		if (q < end) {
+			const char *s;
+			for (s = q; s + 1 < end; s++) {
+				if (s[0] == '\n' && s[1] == '\n') {
+					blank = s + 2;
+					break;
+				}
+			}
+		}
+		q = blank ? blank : end;
+		inputs[n] = p;
+		lens[n] = q - p;
+		n++;
+		p = q;
+	}
+	return n;
+}
+
+// Converts the documents of 'text' one by one and in a batch, printing
+// the median time of each per document.
+static void bench_batch(const char *path, const char *text, size_t len,
+                        size_t size, int threads, int options, int runs,
+                        int warmup, int json)
+{
+	// a document takes at least a byte
+	const char **inputs = (const char **)malloc((len + 1) *
+	                                            sizeof(*inputs));
+	size_t *lens = (size_t *)malloc((len + 1) * sizeof(*lens));
+	size_t *offsets = (size_t *)malloc((len + 2) * sizeof(*offsets));
+	uint64_t *times = (uint64_t *)malloc(2 * runs * sizeof(*times));
+	static const char *names[2] = { "one_by_one", "batch" };
+	size_t n = split_documents(text, len, size, inputs, lens);
+	size_t d;
+	char *out;
+	int i, m;
+
+	for (i = -warmup; i < runs; i++) {
+		uint64_t start = now_ns();
+
+		for (d = 0; d < n; d++) {
+			cmark_free(cmark_markdown_to_html(inputs[d], (int)lens[d],
+			                                  options));
+		}
+		if (i >= 0) {
+			times[i] = now_ns() - start;
+		}
+		start = now_ns();
+		cmark_render_batch(inputs, lens, n, options, offsets, &out,
+		                   threads);
+		cmark_free(out);
+		if (i >= 0) {
+			times[runs + i] = now_ns() - start;
+		}
+	}
+
+	if (json) {
+		printf("{\"file\": ");
+		print_json_string(path);
+		printf(", \"bytes\": %llu, \"documents\": %llu, "
+		       "\"threads\": %d, \"runs\": %d, \"methods\": {",
+		       (unsigned long long)len, (unsigned long long)n, threads,
+		       runs);
+	} else {
+		printf("%s: %llu bytes, %llu documents, %d threads, %d runs\n",
+		       path, (unsigned long long)len, (unsigned long long)n,
+		       threads, runs);
+		printf("%-12s %14s %12s %10s %9s\n", "method", "median_ns",
+		       "mad_ns", "MB/s", "ns/doc");
+	}
+	for (m = 0; m < 2; m++) {
+		uint64_t *values = times + m * runs;
+		double mid = median(values, runs);
+		double dev = mad(values, runs, mid);
+		double mbps = mid > 0 ? (double)len / mid * 1000 : 0;
+		double per_doc = n > 0 ? mid / (double)n : 0;
+
+		if (json) {
+			printf("%s\"%s\": {\"median_ns\": %.0f, \"mad_ns\": %.0f, "
+			       "\"mb_per_s\": %.2f, \"ns_per_document\": %.2f}",
+			       m ? ", " : "", names[m], mid, dev, mbps, per_doc);
+		} else {
+			printf("%-12s %14.0f %12.0f %10.2f %9.2f\n", names[m],
+			       mid, dev, mbps, per_doc);
+		}
+	}
+	if (json) {
+		printf("}}\n");
+	}
+	free(inputs);
+	free(lens);
+	free(offsets);
+	free(times);
+}
+
+int main(int argc, char *argv[])
+{
+	const char **paths;
+	int num_paths = 0;
+	int runs = 10, warmup = 2;
+	int options = CMARK_OPT_DEFAULT;
+	int json = 0, memory = 0;
+	int batch = 0, threads = 1;
+	int status = 0;
+	char *text;
+	size_t len;
+	int i;
+
+	paths = (const char **)malloc(argc * sizeof(*paths));
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+			runs = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+			warmup = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--smart") == 0) {
+			options |= CMARK_OPT_SMART;
+		} else if (strcmp(argv[i], "--memory") == 0) {
+			memory = 1;
+		} else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+			batch = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--json") == 0) {
+			json = 1;
+		} else if (strcmp(argv[i], "--help") == 0 ||
+		           strcmp(argv[i], "-h") == 0) {
+			print_usage();
+			free(paths);
+			return 0;
+		} else if (*argv[i] == '-') {
+			print_usage();
+			free(paths);
+			return 1;
+		} else {
+			paths[num_paths++] = argv[i];
+		}
+	}
+	if (num_paths == 0 || runs < 1 || warmup < 0 || batch < 0 ||
+	    threads < 1) {
+		print_usage();
+		free(paths);
+		return 1;
+	}
+
+	for (i = 0; i < num_paths && status == 0; i++) {
+		text = read_file(paths[i], &len);
+		if (text == NULL) {
+			fprintf(stderr, "Error opening file %s\n", paths[i]);
+			status = 1;
+		} else if (memory) {
+			status = !bench_memory(paths[i], text, len, json);
+		} else if (batch) {
+			bench_batch(paths[i], text, len, batch, threads, options,
+			            runs, warmup, json);
+		} else {
+			bench_time(paths[i], text, len, options, runs, warmup,
+			           json);
+		}
+		free(text);
+	}
+
+	free(paths);
+	return status;
+}
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+
+# Writes a synthetic Markdown corpus for benchmarks.  The same seed,
+# size and mix always give the same bytes, so runs can be compared
+# without fetching anything, and the size can go from kilobytes to
+# gigabytes.
+#
+#     python3 bench/gen_corpus.py --size 11 --seed 1 > bench/benchinput.md
+#     python3 bench/gen_corpus.py --size 100 --mix refs=3,emph=1 -o refs.md
+
+import argparse
+import random
+import sys
+
+WORDS = '''lorem ipsum dolor sit amet consectetur adipiscing elit sed do
+eiusmod tempor incididunt ut labore et dolore magna aliqua enim ad minim
+veniam quis nostrud exercitation ullamco laboris nisi aliquip ex ea
+commodo consequat duis aute irure in reprehenderit voluptate velit esse
+cillum fugiat nulla pariatur excepteur sint occaecat cupidatat non
+proident sunt culpa qui officia deserunt mollit anim id est
+laborum'''.split()
+
+UNICODE_WORDS = '''λόγος καλημέρα θάλασσα привет мир книга 日本語 漢字
+テキスト 한국어 문장 中文 段落 naïve café façade smörgåsbord Ångström
+straße über ünïcödé emoji 🙂 🚀 ✨ ½ € → ∑ ∞'''.split()
+
+ENTITIES = ['&amp;', '&copy;', '&mdash;', '&#8212;', '&#x263A;', '&nbsp;']
+
+HTML_TAGS = ['div', 'section', 'table', 'pre', 'p', 'aside']
+
+LANGS = ['c', 'python', 'js', 'rust', 'sh', '']
+
+
+class Corpus:
+    def __init__(self, rng):
+        self.rng = rng
+        self.nrefs = 0      # reference labels defined so far
+        self.nanchors = 0
+        self.has_toc = False
+
+    def words(self, n, vocab=WORDS):
+        return ' '.join(self.rng.choice(vocab) for _ in range(n))
+
+    def sentence(self, vocab=WORDS):
+        s = self.words(self.rng.randint(5, 15), vocab)
+        return s[0].upper() + s[1:] + '.'
+
+    def lines(self, text, width=72):
+        # wrap at spaces, as hand-written Markdown usually is
+        out, line = [], ''
+        for word in text.split(' '):
+            if line and len(line) + len(word) >= width:
+                out.append(line)
+                line = word
+            else:
+                line = line + ' ' + word if line else word
+        out.append(line)
+        return '\n'.join(out) + '\n'
+
+    def inline(self, extra=()):
+        parts = []
+        for _ in range(self.rng.randint(2, 5)):
+            parts.append(self.sentence())
+            r = self.rng.random()
+            if r < 0.15:
+                parts.append('`%s()`' % self.rng.choice(WORDS))
+            elif r < 0.25:
+                parts.append('[%s](http://example.com/%s "%s")' %
+                             (self.words(2), self.rng.choice(WORDS),
+                              self.words(1)))
+            elif r < 0.3:
+                parts.append('*%s*' % self.words(2))
+            for kind in extra:
+                parts.append(kind())
+        return ' '.join(parts)
+
+    # one generator per kind of content; each returns a block, or a
+    # few, ending with a blank line
+
+    def prose(self):
+        return self.lines(self.inline()) + '\n'
+
+    def lists(self):
+        out = []
+
+        def items(depth, indent):
+            ordered = self.rng.random() < 0.4
+            for i in range(self.rng.randint(2, 5)):
+                marker = '%d.' % (i + 1) if ordered else '-*+'[depth % 3]
+                text = self.lines(self.sentence(), 60).splitlines()
+                out.append(indent + marker + ' ' + text[0])
+                pad = indent + ' ' * (len(marker) + 1)
+                out.extend(pad + t for t in text[1:])
+                if depth < 4 and self.rng.random() < 0.3:
+                    items(depth + 1, pad)
+        items(0, '')
+        return '\n'.join(out) + '\n\n'
+
+    def quotes(self):
+        depth = self.rng.randint(1, 3)
+        prefix = '> ' * depth
+        body = self.lines(self.inline(), 60)
+        if self.rng.random() < 0.3:
+            body += '\n- %s\n- %s\n' % (self.sentence(), self.sentence())
+        return ''.join(prefix + l + '\n' if l else prefix.rstrip() + '\n'
+                       for l in body.splitlines()) + '\n'
+
+    def code(self):
+        body = ''.join('%sx_%d = %s(%d);\n' %
+                       ('    ' * self.rng.randint(0, 2), i,
+                        self.rng.choice(WORDS), self.rng.randint(0, 999))
+                       for i in range(self.rng.randint(3, 20)))
+        if self.rng.random() < 0.7:
+            fence = self.rng.choice(['```', '~~~', '````'])
+            return '%s%s\n%s%s\n\n' % (fence, self.rng.choice(LANGS), body,
+                                       fence)
+        return ''.join('    ' + l + '\n' for l in body.splitlines()) + '\n'
+
+    def refs(self):
+        def ref():
+            if self.nrefs == 0 or self.rng.random() < 0.2:
+                return '[%s][]' % self.words(2)  # not defined: plain text
+            return '[%s][ref%d]' % (self.words(2),
+                                    self.rng.randrange(self.nrefs))
+        text = self.lines(self.inline((ref, ref)))
+        defs = ''.join('[ref%d]: http://example.com/%s/%d "%s"\n' %
+                       (self.nrefs + i, self.rng.choice(WORDS), i,
+                        self.words(2))
+                       for i in range(self.rng.randint(1, 4)))
+        self.nrefs += defs.count('\n')
+        return text + '\n' + defs + '\n'
+
+    def emph(self):
+        def em():
+            w = self.words(self.rng.randint(1, 3))
+            return self.rng.choice([
+                '*%s*', '_%s_', '**%s**', '__%s__', '***%s***',
+                '*%s **nested** text*', '**%s *nested* text**',
+                '*unclosed %s', '%s_with_underscores_inside',
+                '"%s" and \'quoted\'',
+            ]) % w
+        return self.lines(self.inline((em, em, em))) + '\n'
+
+    def html(self):
+        if self.rng.random() < 0.5:
+            tag = self.rng.choice(HTML_TAGS)
+            return '<%s class="c%d">\n%s</%s>\n\n' % (
+                tag, self.rng.randint(0, 9),
+                self.lines(self.words(20), 60), tag)
+
+        def tag():
+            t = self.rng.choice(['span', 'b', 'i', 'kbd', 'abbr'])
+            return '<%s title="%s">%s</%s>' % (t, self.words(1),
+                                               self.words(2), t)
+
+        def comment():
+            return '<!-- %s -->' % self.words(3)
+        return self.lines(self.inline((tag, comment))) + '\n'
+
+    def toc(self):
+        out = ''
+        if not self.has_toc:
+            # only the first table of contents is filled in
+            out += '{toc:4}\n\n'
+            self.has_toc = True
+        if self.rng.random() < 0.1:
+            out += ''.join('<<style%d.css>>\n' % i
+                           for i in range(self.rng.randint(1, 3))) + '\n'
+        self.nanchors += 1
+        out += '%s %s {#sec-%d}\n\n' % ('#' * self.rng.randint(1, 4),
+                                        self.words(3).title(), self.nanchors)
+        return out + self.lines(self.inline()) + '\n'
+
+    def unicode(self):
+        def entity():
+            return self.rng.choice(ENTITIES)
+        text = ' '.join(self.sentence(UNICODE_WORDS)
+                        for _ in range(self.rng.randint(2, 5)))
+        return self.lines(text + ' ' + entity() + ' ' + entity()) + '\n'
+
+
+KINDS = ['prose', 'lists', 'quotes', 'code', 'refs', 'emph', 'html', 'toc',
+         'unicode']
+
+DEFAULT_MIX = 'prose=4,lists=2,quotes=1,code=1,refs=1,emph=1,html=1,toc=1,unicode=1'
+
+
+def parse_mix(text):
+    mix = {}
+    for part in text.split(','):
+        name, _, weight = part.partition('=')
+        name = name.strip()
+        if name not in KINDS:
+            raise argparse.ArgumentTypeError(
+                'unknown kind %r; kinds are %s' % (name, ', '.join(KINDS)))
+        mix[name] = float(weight) if weight else 1.0
+    return mix
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Write a synthetic Markdown corpus.')
+    parser.add_argument('--size', type=float, default=11.0,
+                        help='size of the corpus in MB')
+    parser.add_argument('--seed', type=int, default=1,
+                        help='seed of the random generator')
+    parser.add_argument('--mix', type=parse_mix, default=parse_mix(DEFAULT_MIX),
+                        help='weights of the kinds of content, as '
+                             'kind=weight,... (default %s)' % DEFAULT_MIX)
+    parser.add_argument('-o', '--output', help='output file (default stdout)')
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    corpus = Corpus(rng)
+    kinds = [k for k in KINDS if args.mix.get(k, 0) > 0]
+    weights = [args.mix[k] for k in kinds]
+    size = int(args.size * 1024 * 1024)
+
+    out = open(args.output, 'w', encoding='utf-8') if args.output else \
+        open(sys.stdout.fileno(), 'w', encoding='utf-8', closefd=False)
+    written = 0
+    chunk = []
+    with out:
+        while written < size:
+            block = getattr(corpus, rng.choices(kinds, weights)[0])()
+            chunk.append(block)
+            written += len(block.encode('utf-8'))
+            if len(chunk) >= 1000:
+                out.write(''.join(chunk))
+                chunk = []
+        out.write(''.join(chunk))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+# Times the parser on inputs made of a single kind of line, so that
+# changes to block-start recognition can be measured per line type.
+#
+#     python3 bench/line_types.py --program build/src/cmark
+
+import argparse
+import os
+import statistics
+import subprocess
+import tempfile
+import time
+
+# each entry repeats to fill the input; blank lines keep blocks apart
+LINE_TYPES = {
+    'paragraph': 'Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n',
+    'lazy':      'Lorem ipsum dolor sit amet\n- item\nlazy continuation\n\n',
+    'atx':       '## Header text\n\n',
+    'setext':    'Header text\n-----------\n\n',
+    'hrule':     '* * *\n\n',
+    'bullet':    '- list item text\n',
+    'ordered':   '12. list item text\n',
+    'quote':     '> quoted paragraph text\n',
+    'fence':     '```\ncode\n```\n\n',
+    'indented':  '    indented code line\n',
+    'html':      '<div class="x">\nhtml\n</div>\n\n',
+    'blank':     '\n',
+    # 20 levels of containers that every line has to match again
+    'nestquote': '> ' * 20 + 'quoted paragraph text\n',
+    'nestlist':  '- ' * 20 + 'item\n' + '  ' * 20 + 'continued\n\n',
+    'nestmixed': '> - ' * 10 + 'item\n' + '>   ' * 10 + 'continued\n',
+}
+
+def run(program, path):
+    start = time.perf_counter()
+    with open(path, 'rb') as f:
+        subprocess.run([program], stdin=f, stdout=subprocess.DEVNULL,
+                       check=True)
+    return time.perf_counter() - start
+
+def main():
+    parser = argparse.ArgumentParser(description='Time cmark per line type.')
+    parser.add_argument('--program', dest='program', default='build/src/cmark',
+                        help='path to the cmark program')
+    parser.add_argument('--size', dest='size', type=float, default=4.0,
+                        help='size of each input in MB')
+    parser.add_argument('--runs', dest='runs', type=int, default=5,
+                        help='number of runs per line type')
+    parser.add_argument('types', nargs='*', help='line types to time')
+    args = parser.parse_args()
+
+    names = args.types or list(LINE_TYPES)
+    size = int(args.size * 1024 * 1024)
+    print('%-10s %10s %10s' % ('type', 'median s', 'MB/s'))
+    for name in names:
+        line = LINE_TYPES[name]
+        with tempfile.NamedTemporaryFile('w', suffix='.md',
+                                         delete=False) as f:
+            f.write(line * (size // len(line)))
+            path = f.name
+        try:
+            empty = statistics.median(run(args.program, os.devnull)
+                                      for _ in range(args.runs))
+            times = [run(args.program, path) - empty
+                     for _ in range(args.runs)]
+        finally:
+            os.unlink(path)
+        median = statistics.median(times)
+        print('%-10s %10.4f %10.1f' % (name, median,
+                                       size / (1024 * 1024) / max(median, 1e-9)))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,195 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmark.h"
+
+// Parses an input and renders it to HTML, XML, man and CommonMark,
+// failing if that took too long or made too many nodes for its size:
+// quadratic paths show up here long before a fuzzer's timeout.  The
+// first byte of an input holds the options and the rest is the text,
+// so a Markdown file that starts with a newline parses with --smart
+// and --hardbreaks.
+//
+// Built with -DCMARK_LIB_FUZZER=ON this is a libFuzzer target that
+// aborts on a slow input, so that libFuzzer saves it and can minimize
+// it.  Otherwise it is a driver that checks the files it is given and
+// exits with 1 if any of them is slow.
+//
+// The limits can be set in the environment:
+//
+//     CMARK_FUZZ_NS_PER_BYTE     time allowed per byte (default 10000)
+//     CMARK_FUZZ_MIN_NS          time always allowed (default 10000000)
+//     CMARK_FUZZ_NODES_PER_BYTE  nodes allowed per byte (default 4)
+
+#define OPTIONS_MASK (CMARK_OPT_SOURCEPOS | CMARK_OPT_HARDBREAKS | \
+                      CMARK_OPT_NORMALIZE | CMARK_OPT_SMART | \
+                      CMARK_OPT_RETAIN_INPUT | CMARK_OPT_LAZY_INLINES | \
+                      CMARK_OPT_BLOCKS_ONLY)
+#define WRAP_BIT 0x80
+
+// a slow input is measured again this many times, keeping the fastest
+// run, so that being descheduled doesn't count
+#define RETRIES 2
+
+// nodes always allowed: the document, a paragraph and so on
+#define MIN_NODES 16
+
+typedef struct {
+	uint64_t ns_per_byte;
+	uint64_t min_ns;
+	uint64_t nodes_per_byte;
+} limits;
+
+typedef struct {
+	uint64_t ns;
+	uint64_t nodes;
+} cost;
+
+static uint64_t S_getenv(const char *name, uint64_t def)
+{
+	const char *value = getenv(name);
+
+	return value && *value ? strtoull(value, NULL, 10) : def;
+}
+
+static const limits *S_limits(void)
+{
+	static limits lim;
+	static int initialized;
+
+	if (!initialized) {
+		lim.ns_per_byte = S_getenv("CMARK_FUZZ_NS_PER_BYTE", 10000);
+		lim.min_ns = S_getenv("CMARK_FUZZ_MIN_NS", 10000000);
+		lim.nodes_per_byte = S_getenv("CMARK_FUZZ_NODES_PER_BYTE", 4);
+		initialized = 1;
+	}
+	return &lim;
+}
+
+static void S_measure(const char *text, size_t len, int options, int width,
+                      cost *c)
+{
+	cmark_parser_stats stats;
+	cmark_parser *parser;
+	cmark_node *doc;
+	size_t i;
+
+	memset(&stats, 0, sizeof(stats));
+	parser = cmark_parser_new(options);
+	cmark_parser_set_stats(parser, &stats);
+	cmark_parser_feed(parser, text, len);
+	doc = cmark_parser_finish(parser);
+	cmark_parser_free(parser);
+
+	cmark_free(cmark_render_html(doc, options));
+	cmark_free(cmark_render_xml(doc, options));
+	cmark_free(cmark_render_man(doc, options));
+	cmark_free(cmark_render_commonmark(doc, options, width));
+	cmark_node_free(doc);
+
+	c->ns = stats.lines_ns + stats.finalize_ns + stats.inlines_ns +
+	        stats.postprocess_ns + stats.render_ns + stats.free_ns;
+	c->nodes = 0;
+	for (i = 0; i < sizeof(stats.nodes) / sizeof(stats.nodes[0]); i++) {
+		c->nodes += stats.nodes[i];
+	}
+}
+
+// Returns 1 and describes the problem on stderr if 'data' is slow.
+static int S_check(const char *name, const uint8_t *data, size_t size)
+{
+	const limits *lim = S_limits();
+	const char *text = (const char *)data + (size > 0);
+	size_t len = size > 0 ? size - 1 : 0;
+	int options = size > 0 ? data[0] & OPTIONS_MASK : 0;
+	int width = size > 0 && (data[0] & WRAP_BIT) ? 72 : 0;
+	uint64_t max_ns = lim->min_ns + lim->ns_per_byte * len;
+	uint64_t max_nodes = MIN_NODES + lim->nodes_per_byte * len;
+	cost c, retry;
+	int i;
+
+	S_measure(text, len, options, width, &c);
+	for (i = 0; i < RETRIES && c.ns > max_ns; i++) {
+		S_measure(text, len, options, width, &retry);
+		if (retry.ns < c.ns) {
+			c.ns = retry.ns;
+		}
+	}
+	if (c.ns <= max_ns && c.nodes <= max_nodes) {
+		return 0;
+	}
+	fprintf(stderr, "%s: slow input: %lu bytes, options %d, width %d: "
+	        "%.3f ms (limit %.3f), %lu nodes (limit %lu)\n",
+	        name, (unsigned long)len, options, width, c.ns / 1e6,
+	        max_ns / 1e6, (unsigned long)c.nodes,
+	        (unsigned long)max_nodes);
+	return 1;
+}
+
+#ifdef CMARK_LIB_FUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	if (S_check("cmark_fuzzer", data, size)) {
+		abort();
+	}
+	return 0;
+}
+
+#else
+
+static uint8_t *read_file(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *buf = NULL;
+	size_t size = 0, n;
+	uint8_t chunk[65536];
+
+	if (f == NULL) {
+		return NULL;
+	}
+	while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+		uint8_t *p = (uint8_t *)realloc(buf, size + n + 1);
+		if (p == NULL) {
+			free(buf);
+			fclose(f);
+			return NULL;
+		}
+		buf = p;
+		memcpy(buf + size, chunk, n);
+		size += n;
+	}
+	fclose(f);
+	if (buf == NULL) {
+		// an empty file
+		buf = (uint8_t *)malloc(1);
+	}
+	*len = size;
+	return buf;
+}
+
+int main(int argc, char *argv[])
+{
+	int i, slow = 0;
+
+	if (argc < 2) {
+		fprintf(stderr, "Usage: cmark_fuzz FILE+\n");
+		return 2;
+	}
+	for (i = 1; i < argc; i++) {
+		size_t len;
+		uint8_t *data = read_file(argv[i], &len);
+
+		if (data == NULL) {
+			perror(argv[i]);
+			return 2;
+		}
+		slow |= S_check(argv[i], data, len);
+		free(data);
+	}
+	return slow;
+}
+
+#endif
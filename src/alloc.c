@@ -0,0 +1,236 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cmark.h"
+#include "alloc.h"
+
+#ifdef CMARK_ALLOC_STATS
+
+// Blocks allocated by the library, in an open-addressed table keyed by
+// address.  A block freed with free() stays in the table until its
+// address is allocated again, and is counted as live until then.
+
+typedef struct {
+	void *ptr;
+	size_t size;
+	cmark_alloc_source source;
+} alloc_entry;
+
+#define TABLE_MIN_SIZE 1024
+
+static alloc_entry *table;
+static size_t table_size;  // a power of two, or 0
+static size_t table_used;
+static cmark_alloc_stats counts;
+
+static inline size_t S_slot(const void *ptr)
+{
+	uintptr_t x = (uintptr_t)ptr;
+
+	// the low bits are the same for every block
+	x ^= x >> 4;
+	x *= 2654435761u;
+	return (size_t)(x ^ (x >> 15)) & (table_size - 1);
+}
+
+static void S_count_alloc(cmark_alloc_source source, size_t size)
+{
+	cmark_alloc_counts *c = &counts.sources[source];
+
+	c->allocs++;
+	c->bytes += size;
+	c->live += size;
+	if (c->live > c->peak) {
+		c->peak = c->live;
+	}
+	counts.total.allocs++;
+	counts.total.bytes += size;
+	counts.total.live += size;
+	if (counts.total.live > counts.total.peak) {
+		counts.total.peak = counts.total.live;
+	}
+}
+
+static void S_count_free(const alloc_entry *e)
+{
+	counts.sources[e->source].live -= e->size;
+	counts.total.live -= e->size;
+}
+
+static void S_insert(alloc_entry *t, size_t size, const alloc_entry *e)
+{
+	size_t mask = size - 1;
+	size_t i;
+
+	for (i = S_slot(e->ptr); t[i].ptr; i = (i + 1) & mask)
+		;
+	t[i] = *e;
+}
+
+// Doubles the table when it is half full.  If that fails, the table
+// fills up and new blocks are no longer recorded.
+static void S_maybe_grow(void)
+{
+	size_t new_size = table_size ? table_size * 2 : TABLE_MIN_SIZE;
+	alloc_entry *new_table;
+	size_t i;
+
+	if (table_used < table_size / 2) {
+		return;
+	}
+	new_table = (alloc_entry *)calloc(new_size, sizeof(*new_table));
+	if (new_table == NULL) {
+		return;
+	}
+	// S_slot uses table_size
+	i = table_size;
+	table_size = new_size;
+	while (i-- > 0) {
+		if (table[i].ptr) {
+			S_insert(new_table, new_size, &table[i]);
+		}
+	}
+	free(table);
+	table = new_table;
+}
+
+static void S_record(void *ptr, size_t size, cmark_alloc_source source)
+{
+	size_t i;
+
+	S_maybe_grow();
+	if (table_used + 1 >= table_size) {
+		return;
+	}
+	for (i = S_slot(ptr); table[i].ptr; i = (i + 1) & (table_size - 1)) {
+		if (table[i].ptr == ptr) {
+			// freed with free() and allocated again
+			S_count_free(&table[i]);
+			table_used--;
+			break;
+		}
+	}
+	table[i].ptr = ptr;
+	table[i].size = size;
+	table[i].source = source;
+	table_used++;
+	S_count_alloc(source, size);
+}
+
+// Removes the entry of 'ptr' into 'e', returning 0 if there is none.
+static int S_forget(void *ptr, alloc_entry *e)
+{
+	size_t mask = table_size - 1;
+	size_t i, j, k;
+
+	if (table_size == 0) {
+		return 0;
+	}
+	for (i = S_slot(ptr); table[i].ptr != ptr; i = (i + 1) & mask) {
+		if (table[i].ptr == NULL) {
+			return 0;
+		}
+	}
+	*e = table[i];
+	S_count_free(e);
+	table_used--;
+
+	// move back the entries after it that would no longer be found
+	for (j = (i + 1) & mask; table[j].ptr; j = (j + 1) & mask) {
+		k = S_slot(table[j].ptr);
+		if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+			table[i] = table[j];
+			i = j;
+		}
+	}
+	table[i].ptr = NULL;
+	return 1;
+}
+
+void *cmark_alloc_malloc(cmark_alloc_source source, size_t size)
+{
+	void *ptr = malloc(size);
+
+	if (ptr != NULL) {
+		S_record(ptr, size, source);
+	}
+	return ptr;
+}
+
+void *cmark_alloc_calloc(cmark_alloc_source source, size_t n, size_t size)
+{
+	void *ptr = calloc(n, size);
+
+	if (ptr != NULL) {
+		S_record(ptr, n * size, source);
+	}
+	return ptr;
+}
+
+void *cmark_alloc_realloc(cmark_alloc_source source, void *ptr, size_t size)
+{
+	alloc_entry old;
+	int known = ptr != NULL && S_forget(ptr, &old);
+	void *new_ptr = realloc(ptr, size);
+
+	if (new_ptr != NULL) {
+		S_record(new_ptr, size, source);
+	} else if (known) {
+		// the old block is still there
+		S_insert(table, table_size, &old);
+		table_used++;
+		counts.sources[old.source].live += old.size;
+		counts.total.live += old.size;
+	}
+	return new_ptr;
+}
+
+void cmark_alloc_free(void *ptr)
+{
+	alloc_entry e;
+
+	if (ptr != NULL) {
+		S_forget(ptr, &e);
+		free(ptr);
+	}
+}
+
+int cmark_alloc_stats_get(cmark_alloc_stats *stats)
+{
+	*stats = counts;
+	return 1;
+}
+
+void cmark_alloc_stats_reset(void)
+{
+	int i;
+
+	for (i = 0; i < CMARK_ALLOC_NUM_SOURCES; i++) {
+		counts.sources[i].allocs = 0;
+		counts.sources[i].bytes = 0;
+		counts.sources[i].peak = counts.sources[i].live;
+	}
+	counts.total.allocs = 0;
+	counts.total.bytes = 0;
+	counts.total.peak = counts.total.live;
+}
+
+#else
+
+int cmark_alloc_stats_get(cmark_alloc_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	return 0;
+}
+
+void cmark_alloc_stats_reset(void)
+{
+}
+
+#endif
+
+void cmark_free(void *ptr)
+{
+	CMARK_FREE(ptr);
+}
@@ -0,0 +1,52 @@
+#ifndef CMARK_ALLOC_H
+#define CMARK_ALLOC_H
+
+#include <stdlib.h>
+
+#include "cmark.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Allocation in the library, tagged with the cmark_alloc_source it is
+// counted against:
+//
+//     cmark_node *node = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*node));
+//     ...
+//     CMARK_FREE(node);
+//
+// Without CMARK_ALLOC_STATS these are the functions of the C library.
+// With it, every block is recorded in a table, so CMARK_FREE can be
+// given memory that was not allocated here (user data, for one) and
+// memory allocated here may still be freed with free().
+
+#ifdef CMARK_ALLOC_STATS
+
+void *cmark_alloc_malloc(cmark_alloc_source source, size_t size);
+void *cmark_alloc_calloc(cmark_alloc_source source, size_t n, size_t size);
+void *cmark_alloc_realloc(cmark_alloc_source source, void *ptr, size_t size);
+void cmark_alloc_free(void *ptr);
+
+#define CMARK_MALLOC(source, size) \
+	cmark_alloc_malloc(CMARK_ALLOC_##source, size)
+#define CMARK_CALLOC(source, n, size) \
+	cmark_alloc_calloc(CMARK_ALLOC_##source, n, size)
+#define CMARK_REALLOC(source, ptr, size) \
+	cmark_alloc_realloc(CMARK_ALLOC_##source, ptr, size)
+#define CMARK_FREE(ptr) cmark_alloc_free(ptr)
+
+#else
+
+#define CMARK_MALLOC(source, size) malloc(size)
+#define CMARK_CALLOC(source, n, size) calloc(n, size)
+#define CMARK_REALLOC(source, ptr, size) realloc(ptr, size)
+#define CMARK_FREE(ptr) free(ptr)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "cmark.h"
+#include "node.h"
+#include "alloc.h"
+#include "buffer.h"
+#include "parser.h"
+#include "html.h"
+
+#if defined(HAVE_PTHREAD) && !defined(CMARK_ALLOC_STATS)
+// the allocation counts are not kept under a lock
+#define BATCH_THREADS
+#include <pthread.h>
+#endif
+
+// Documents parsed one after the other by one parser, in the same
+// document node and string pool, and rendered into one buffer.
+typedef struct {
+	const char **inputs;
+	const size_t *lens;
+	size_t n;
+	int options;
+	size_t *offsets;   // of the HTML of each document in 'html'
+	cmark_strbuf html;
+} batch_run;
+
+static void S_render_run(batch_run *run)
+{
+	cmark_parser *parser = cmark_parser_new(run->options);
+	cmark_node *document;
+	size_t i;
+
+	for (i = 0; i < run->n; i++) {
+		if (i > 0) {
+			cmark_parser_reset(parser);
+		}
+		run->offsets[i] = (size_t)run->html.size;
+		cmark_parser_feed(parser, run->inputs[i], run->lens[i]);
+		document = cmark_parser_finish(parser);
+		cmark_render_html_append(&run->html, document, run->options);
+	}
+	cmark_node_free(parser->root);
+	cmark_parser_free(parser);
+}
+
+#ifdef BATCH_THREADS
+static void *S_run_thread(void *data)
+{
+	S_render_run((batch_run *)data);
+	return NULL;
+}
+
+// Renders the first run in the calling thread and each other one in a
+// thread of its own, or in the calling thread too if that can't start.
+static void S_render_threads(batch_run *runs, int nruns)
+{
+	pthread_t *ids = NULL;
+	int *started = NULL;
+	int r;
+
+	if (nruns > 1) {
+		ids = (pthread_t *)CMARK_CALLOC(OTHER, nruns, sizeof(*ids));
+		started = (int *)CMARK_CALLOC(OTHER, nruns, sizeof(*started));
+	}
+	for (r = 1; ids && started && r < nruns; r++) {
+		started[r] = pthread_create(&ids[r], NULL, S_run_thread,
+		                            &runs[r]) == 0;
+	}
+	S_render_run(&runs[0]);
+	for (r = 1; r < nruns; r++) {
+		if (started && started[r]) {
+			pthread_join(ids[r], NULL);
+		} else {
+			S_render_run(&runs[r]);
+		}
+	}
+	CMARK_FREE(ids);
+	CMARK_FREE(started);
+}
+#endif
+
+// Splits the documents into 'nruns' runs of about the same input size.
+static void S_split(const char **inputs, const size_t *lens, size_t n,
+                    int options, size_t *offsets, batch_run *runs,
+                    int nruns)
+{
+	size_t total = 0, done = 0, first = 0, i;
+	int r = 0;
+
+	for (i = 0; i < n; i++) {
+		total += lens[i];
+	}
+	for (i = 0; i < n; i++) {
+		done += lens[i];
+		// every run gets at least one document
+		if (r < nruns - 1 &&
+		    (done >= total / nruns * (r + 1) ||
+		     n - i - 1 == (size_t)(nruns - r - 1))) {
+			runs[r].n = i + 1 - first;
+			runs[r].inputs = inputs + first;
+			runs[r].lens = lens + first;
+			runs[r].offsets = offsets + first;
+			first = i + 1;
+			r++;
+		}
+	}
+	runs[r].n = n - first;
+	runs[r].inputs = inputs + first;
+	runs[r].lens = lens + first;
+	runs[r].offsets = offsets + first;
+	for (r = 0; r < nruns; r++) {
+		runs[r].options = options;
+		cmark_strbuf_init(&runs[r].html, 0);
+	}
+}
+
+int cmark_render_batch(const char **inputs, const size_t *lens, size_t n,
+                       int options, size_t *out_offsets, char **out_buffer,
+                       int threads)
+{
+	batch_run *runs;
+	int nruns = 1, r, ok = 1;
+	size_t i, base;
+
+#ifdef BATCH_THREADS
+	if (threads > 1) {
+		nruns = (size_t)threads < n ? threads : (int)n;
+	}
+#else
+	(void)threads;
+#endif
+	if (nruns < 1) {
+		nruns = 1;
+	}
+	runs = (batch_run *)CMARK_CALLOC(OTHER, nruns, sizeof(*runs));
+	if (runs == NULL) {
+		*out_buffer = NULL;
+		return 0;
+	}
+	S_split(inputs, lens, n, options, out_offsets, runs, nruns);
+
+#ifdef BATCH_THREADS
+	S_render_threads(runs, nruns);
+#else
+	S_render_run(&runs[0]);
+#endif
+
+	for (r = 0; r < nruns; r++) {
+		ok = ok && !cmark_strbuf_oom(&runs[r].html);
+	}
+	// the HTML of the other runs follows that of the first
+	for (r = 1; r < nruns; r++) {
+		base = (size_t)runs[0].html.size;
+		for (i = 0; i < runs[r].n; i++) {
+			runs[r].offsets[i] += base;
+		}
+		cmark_strbuf_put(&runs[0].html, runs[r].html.ptr,
+		                 runs[r].html.size);
+		cmark_strbuf_free(&runs[r].html);
+	}
+	ok = ok && !cmark_strbuf_oom(&runs[0].html);
+	out_offsets[n] = (size_t)runs[0].html.size;
+	if (ok) {
+		*out_buffer = (char *)cmark_strbuf_detach(&runs[0].html);
+	} else {
+		cmark_strbuf_free(&runs[0].html);
+		*out_buffer = NULL;
+	}
+	CMARK_FREE(runs);
+	return ok;
+}
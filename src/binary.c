@@ -0,0 +1,513 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "cmark.h"
+#include "alloc.h"
+#include "node.h"
+#include "buffer.h"
+#include "iterator.h"
+#include "doc.h"
+
+// Serialization of node trees to a relocatable binary image, and
+// zero-copy walking of such an image.
+
+static void
+S_put_string(cmark_strbuf *pool, cmark_binary_node *rec, int slot,
+             const unsigned char *data, int len)
+{
+	rec->str[slot][0] = (uint32_t)pool->size;
+	rec->str[slot][1] = (uint32_t)len;
+	if (len > 0) {
+		cmark_strbuf_put(pool, data, len);
+	}
+	cmark_strbuf_putc(pool, '\0');
+}
+
+static void
+S_put_chunk(cmark_strbuf *pool, cmark_binary_node *rec, int slot,
+            cmark_chunk *chunk)
+{
+	S_put_string(pool, rec, slot, chunk->data, chunk->len);
+}
+
+static void
+S_put_cstr(cmark_strbuf *pool, cmark_binary_node *rec, int slot,
+           const char *str)
+{
+	if (str != NULL) {
+		S_put_string(pool, rec, slot, (const unsigned char *)str,
+		             strlen(str));
+	}
+}
+
+static void
+S_serialize_node(cmark_node *node, cmark_binary_node *rec, cmark_strbuf *pool)
+{
+	int i;
+
+	memset(rec, 0, sizeof(*rec));
+	for (i = 0; i < CMARK_BINARY_NUM_STRINGS; i++) {
+		rec->str[i][0] = CMARK_BINARY_NO_STRING;
+	}
+
+	cmark_node_ensure_position(node);
+	rec->type         = node->type;
+	rec->start_line   = node->start_line;
+	rec->start_column = node->start_column;
+	rec->end_line     = node->end_line;
+	rec->end_column   = node->end_column;
+
+	switch (node->type) {
+	case CMARK_NODE_TEXT:
+	case CMARK_NODE_CODE:
+	case CMARK_NODE_HTML:
+	case CMARK_NODE_INLINE_HTML:
+	case CMARK_NODE_INLINE_LINK:
+	case CMARK_NODE_INCLUDE:
+		S_put_chunk(pool, rec, CMARK_BINARY_STR_LITERAL,
+		            cmark_node_literal(node));
+		break;
+
+	case CMARK_NODE_CODE_BLOCK:
+		S_put_chunk(pool, rec, CMARK_BINARY_STR_LITERAL,
+		            cmark_node_literal(node));
+		S_put_chunk(pool, rec, CMARK_BINARY_STR_EXTRA,
+		            &node->as.code.info);
+		rec->ints[0] = node->as.code.fence_length;
+		rec->ints[1] = node->as.code.fence_offset;
+		rec->ints[2] = node->as.code.fence_char;
+		rec->ints[3] = node->as.code.fenced;
+		break;
+
+	case CMARK_NODE_LINK:
+	case CMARK_NODE_IMAGE:
+		S_put_chunk(pool, rec, CMARK_BINARY_STR_LITERAL,
+		            &node->as.link.url);
+		S_put_chunk(pool, rec, CMARK_BINARY_STR_EXTRA,
+		            &node->as.link.title);
+		break;
+
+	case CMARK_NODE_LIST:
+		rec->ints[0] = node->as.list.list_type;
+		rec->ints[1] = node->as.list.start;
+		rec->ints[2] = node->as.list.delimiter |
+		               (node->as.list.bullet_char << 8);
+		rec->ints[3] = node->as.list.tight;
+		break;
+
+	case CMARK_NODE_HEADER:
+		rec->ints[0] = node->as.header.level;
+		rec->ints[1] = node->as.header.setext;
+		// the header id assigned for the table of contents
+		S_put_cstr(pool, rec, CMARK_BINARY_STR_USER,
+		           (const char *)node->user_data);
+		break;
+
+	case CMARK_NODE_TOC:
+		S_put_cstr(pool, rec, CMARK_BINARY_STR_USER,
+		           (const char *)node->user_data);
+		break;
+
+	case CMARK_NODE_ITEM:
+		// items of a table of contents carry their level
+		if (node->parent && node->parent->type == CMARK_NODE_TOC) {
+			S_put_cstr(pool, rec, CMARK_BINARY_STR_USER,
+			           (const char *)node->user_data);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+unsigned char *cmark_serialize_binary(cmark_node *root, size_t *len)
+{
+	cmark_strbuf nodes = GH_BUF_INIT;
+	cmark_strbuf pool = GH_BUF_INIT;
+	cmark_strbuf open = GH_BUF_INIT;
+	cmark_binary_header header;
+	cmark_binary_node rec;
+	cmark_event_type ev_type;
+	cmark_node *cur;
+	cmark_iter *iter;
+	uint32_t count = 0;
+	uint32_t depth = 0;
+	uint32_t max_depth = 0;
+	uint32_t index;
+	unsigned char *result = NULL;
+
+	if (len != NULL) {
+		*len = 0;
+	}
+	iter = cmark_iter_new(root);
+	if (iter == NULL) {
+		return NULL;
+	}
+
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER) {
+			S_serialize_node(cur, &rec, &pool);
+			rec.end = count + 1;
+			cmark_strbuf_put(&nodes, (unsigned char *)&rec,
+			                 sizeof(rec));
+			if (depth > max_depth) {
+				max_depth = depth;
+			}
+			if (!cmark_node_type_is_leaf(cur->type)) {
+				// remember the record so EXIT can fill in 'end'
+				cmark_strbuf_put(&open, (unsigned char *)&count,
+				                 sizeof(count));
+				depth++;
+			}
+			count++;
+		} else {
+			depth--;
+			memcpy(&index, open.ptr + depth * sizeof(index),
+			       sizeof(index));
+			cmark_strbuf_truncate(&open, depth * sizeof(index));
+			((cmark_binary_node *)nodes.ptr)[index].end = count;
+		}
+	}
+	cmark_iter_free(iter);
+
+	if (!cmark_strbuf_oom(&nodes) && !cmark_strbuf_oom(&pool) &&
+	    !cmark_strbuf_oom(&open)) {
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, CMARK_BINARY_MAGIC, 4);
+		header.version     = CMARK_BINARY_VERSION;
+		header.byte_order  = CMARK_BINARY_BYTE_ORDER;
+		header.node_count  = count;
+		header.max_depth   = max_depth;
+		header.pool_offset = sizeof(header) + nodes.size;
+		header.pool_size   = pool.size;
+
+		result = (unsigned char *)CMARK_MALLOC(OTHER,
+		                                       header.pool_offset +
+		                                       header.pool_size);
+		if (result != NULL) {
+			memcpy(result, &header, sizeof(header));
+			memcpy(result + sizeof(header), nodes.ptr, nodes.size);
+			memcpy(result + header.pool_offset, pool.ptr, pool.size);
+			if (len != NULL) {
+				*len = header.pool_offset + header.pool_size;
+			}
+		}
+	}
+
+	cmark_strbuf_free(&nodes);
+	cmark_strbuf_free(&pool);
+	cmark_strbuf_free(&open);
+	return result;
+}
+
+static bool
+S_valid_string(const cmark_binary_header *header, const unsigned char *pool,
+               const uint32_t *str)
+{
+	if (str[0] == CMARK_BINARY_NO_STRING) {
+		return true;
+	}
+	return str[0] < header->pool_size &&
+	       str[1] < header->pool_size - str[0] &&
+	       pool[str[0] + str[1]] == '\0';
+}
+
+// Checks everything the walker and the renderers rely on, so that
+// a corrupt or hostile image is rejected up front.
+static bool
+S_validate(const cmark_binary_header *header, const cmark_binary_node *nodes,
+           const unsigned char *pool)
+{
+	uint32_t n = header->node_count;
+	uint32_t *open;
+	uint32_t depth = 0;
+	uint32_t limit;
+	uint32_t i;
+	int slot;
+	bool ok = true;
+	const cmark_binary_node *rec;
+
+	open = (uint32_t *)CMARK_MALLOC(OTHER, (header->max_depth + 1) *
+	                                       sizeof(*open));
+	if (open == NULL) {
+		return false;
+	}
+
+	for (i = 0; ok && i < n; i++) {
+		rec = &nodes[i];
+		while (depth > 0 && i >= nodes[open[depth - 1]].end) {
+			depth--;
+		}
+		limit = depth > 0 ? nodes[open[depth - 1]].end : n;
+
+		ok = (i == 0 || depth > 0) &&
+		     depth <= header->max_depth &&
+		     rec->type >= CMARK_NODE_FIRST_BLOCK &&
+		     rec->type <= CMARK_NODE_LAST_INLINE &&
+		     rec->end > i && rec->end <= limit &&
+		     (i > 0 || rec->end == n);
+
+		for (slot = 0; ok && slot < CMARK_BINARY_NUM_STRINGS; slot++) {
+			ok = S_valid_string(header, pool, rec->str[slot]);
+		}
+		if (!ok) {
+			break;
+		}
+
+		if (rec->type == CMARK_NODE_ITEM && depth > 0 &&
+		    nodes[open[depth - 1]].type == CMARK_NODE_TOC &&
+		    rec->str[CMARK_BINARY_STR_USER][0] ==
+		    CMARK_BINARY_NO_STRING) {
+			ok = false;
+		} else if (cmark_node_type_is_leaf((cmark_node_type)rec->type)) {
+			ok = rec->end == i + 1;
+		} else if (depth < header->max_depth || rec->end == i + 1) {
+			open[depth++] = i;
+		} else {
+			ok = false;
+		}
+	}
+
+	CMARK_FREE(open);
+	return ok;
+}
+
+cmark_doc *cmark_doc_map(const void *ptr, size_t len)
+{
+	const cmark_binary_header *header = (const cmark_binary_header *)ptr;
+	const unsigned char *image = (const unsigned char *)ptr;
+	size_t avail;
+	cmark_doc *doc;
+
+	if (ptr == NULL || ((uintptr_t)ptr % sizeof(uint32_t)) != 0 ||
+	    len < sizeof(*header)) {
+		return NULL;
+	}
+	if (memcmp(header->magic, CMARK_BINARY_MAGIC, 4) != 0 ||
+	    header->version != CMARK_BINARY_VERSION ||
+	    header->byte_order != CMARK_BINARY_BYTE_ORDER) {
+		return NULL;
+	}
+
+	avail = len - sizeof(*header);
+	if (header->node_count == 0 ||
+	    header->node_count > avail / sizeof(cmark_binary_node) ||
+	    header->max_depth >= header->node_count ||
+	    header->pool_offset != sizeof(*header) +
+	    header->node_count * sizeof(cmark_binary_node) ||
+	    header->pool_size > len - header->pool_offset) {
+		return NULL;
+	}
+
+	if (!S_validate(header,
+	                (const cmark_binary_node *)(image + sizeof(*header)),
+	                image + header->pool_offset)) {
+		return NULL;
+	}
+
+	doc = (cmark_doc *)CMARK_CALLOC(OTHER, 1, sizeof(*doc));
+	if (doc == NULL) {
+		return NULL;
+	}
+	cmark_strbuf_init(&doc->source, 0);
+	doc->image  = image;
+	doc->header = header;
+	doc->nodes  = (const cmark_binary_node *)(image + sizeof(*header));
+	doc->pool   = image + header->pool_offset;
+	return doc;
+}
+
+static cmark_chunk
+S_get_chunk(cmark_doc *doc, const cmark_binary_node *rec, int slot)
+{
+	cmark_chunk c = CMARK_CHUNK_EMPTY;
+
+	if (rec->str[slot][0] != CMARK_BINARY_NO_STRING) {
+		c.data = (unsigned char *)doc->pool + rec->str[slot][0];
+		c.len  = rec->str[slot][1];
+	}
+	return c;
+}
+
+// Accessors such as cmark_node_get_literal may have replaced a pool
+// slice with a heap copy.
+static void
+S_release_node(cmark_node *node)
+{
+	switch (node->type) {
+	case CMARK_NODE_CODE_BLOCK:
+		cmark_chunk_free(&node->as.code.literal);
+		cmark_chunk_free(&node->as.code.info);
+		break;
+	case CMARK_NODE_LINK:
+	case CMARK_NODE_IMAGE:
+		cmark_chunk_free(&node->as.link.url);
+		cmark_chunk_free(&node->as.link.title);
+		break;
+	case CMARK_NODE_TEXT:
+	case CMARK_NODE_CODE:
+	case CMARK_NODE_HTML:
+	case CMARK_NODE_INLINE_HTML:
+	case CMARK_NODE_INLINE_LINK:
+	case CMARK_NODE_INCLUDE:
+		cmark_chunk_free(&node->as.literal);
+		break;
+	default:
+		break;
+	}
+}
+
+static void
+S_load_node(cmark_doc *doc, cmark_node *scratch, int depth, uint32_t i)
+{
+	const cmark_binary_node *rec = &doc->nodes[i];
+	cmark_node *node = &scratch[depth];
+	cmark_chunk user;
+
+	S_release_node(node);
+	memset(node, 0, sizeof(*node));
+
+	node->type         = (cmark_node_type)rec->type;
+	node->start_line   = rec->start_line;
+	node->start_column = rec->start_column;
+	node->end_line     = rec->end_line;
+	node->end_column   = rec->end_column;
+	node->parent       = depth > 0 ? &scratch[depth - 1] : NULL;
+	if (rec->end > i + 1) {
+		// the child is loaded into the next slot before it is visited
+		node->first_child = &scratch[depth + 1];
+		node->last_child  = &scratch[depth + 1];
+	}
+
+	user = S_get_chunk(doc, rec, CMARK_BINARY_STR_USER);
+	node->user_data = user.data;
+
+	switch (node->type) {
+	case CMARK_NODE_TEXT:
+	case CMARK_NODE_CODE:
+	case CMARK_NODE_HTML:
+	case CMARK_NODE_INLINE_HTML:
+	case CMARK_NODE_INLINE_LINK:
+	case CMARK_NODE_INCLUDE:
+		node->as.literal = S_get_chunk(doc, rec, CMARK_BINARY_STR_LITERAL);
+		break;
+
+	case CMARK_NODE_CODE_BLOCK:
+		node->as.code.literal = S_get_chunk(doc, rec,
+		                                    CMARK_BINARY_STR_LITERAL);
+		node->as.code.info = S_get_chunk(doc, rec, CMARK_BINARY_STR_EXTRA);
+		node->as.code.fence_length = rec->ints[0];
+		node->as.code.fence_offset = (int8_t)rec->ints[1];
+		node->as.code.fence_char   = (unsigned char)rec->ints[2];
+		node->as.code.fenced       = rec->ints[3] != 0;
+		break;
+
+	case CMARK_NODE_LINK:
+	case CMARK_NODE_IMAGE:
+		node->as.link.url   = S_get_chunk(doc, rec,
+		                                  CMARK_BINARY_STR_LITERAL);
+		node->as.link.title = S_get_chunk(doc, rec,
+		                                  CMARK_BINARY_STR_EXTRA);
+		break;
+
+	case CMARK_NODE_LIST:
+		node->as.list.list_type   = (cmark_list_type)rec->ints[0];
+		node->as.list.start       = rec->ints[1];
+		node->as.list.delimiter   = (cmark_delim_type)(rec->ints[2] & 0xff);
+		node->as.list.bullet_char = (unsigned char)(rec->ints[2] >> 8);
+		node->as.list.tight       = rec->ints[3] != 0;
+		break;
+
+	case CMARK_NODE_HEADER:
+		node->as.header.level  = rec->ints[0];
+		node->as.header.setext = rec->ints[1] != 0;
+		break;
+
+	default:
+		break;
+	}
+}
+
+// Walks a document backed by a node tree rather than an image.
+static int
+S_walk_tree(cmark_node *root, cmark_doc_walk_fn fn, void *data)
+{
+	cmark_event_type ev_type;
+	cmark_node *cur;
+	cmark_iter *iter = cmark_iter_new(root);
+
+	if (iter == NULL) {
+		return 0;
+	}
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (!fn(cur, ev_type, data) && ev_type == CMARK_EVENT_ENTER &&
+		    !cmark_node_type_is_leaf(cur->type)) {
+			cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
+			fn(cur, CMARK_EVENT_EXIT, data);
+		}
+	}
+	cmark_iter_free(iter);
+	return 1;
+}
+
+int cmark_doc_walk(cmark_doc *doc, cmark_doc_walk_fn fn, void *data)
+{
+	uint32_t n;
+	uint32_t max_depth;
+	cmark_node *scratch;
+	uint32_t *ends;
+	uint32_t i = 0;
+	uint32_t d;
+	int depth = 0;
+	cmark_node *cur;
+
+	if (doc->root != NULL) {
+		return S_walk_tree(doc->root, fn, data);
+	}
+	n = doc->header->node_count;
+	max_depth = doc->header->max_depth;
+	scratch = (cmark_node *)CMARK_CALLOC(OTHER, max_depth + 1, sizeof(*scratch));
+	ends = (uint32_t *)CMARK_MALLOC(OTHER, (max_depth + 1) * sizeof(*ends));
+	if (scratch == NULL || ends == NULL) {
+		CMARK_FREE(scratch);
+		CMARK_FREE(ends);
+		return 0;
+	}
+
+	while (i < n) {
+		while (depth > 0 && i >= ends[depth - 1]) {
+			depth--;
+			fn(&scratch[depth], CMARK_EVENT_EXIT, data);
+		}
+
+		S_load_node(doc, scratch, depth, i);
+		cur = &scratch[depth];
+
+		if (!fn(cur, CMARK_EVENT_ENTER, data) &&
+		    !cmark_node_type_is_leaf(cur->type)) {
+			fn(cur, CMARK_EVENT_EXIT, data);
+			i = doc->nodes[i].end;
+		} else if (cmark_node_type_is_leaf(cur->type)) {
+			i++;
+		} else {
+			ends[depth++] = doc->nodes[i].end;
+			i++;
+		}
+	}
+	while (depth > 0) {
+		depth--;
+		fn(&scratch[depth], CMARK_EVENT_EXIT, data);
+	}
+
+	for (d = 0; d <= max_depth; d++) {
+		S_release_node(&scratch[d]);
+	}
+	CMARK_FREE(scratch);
+	CMARK_FREE(ends);
+	return 1;
+}
@@ -1,18 +1,32 @@
+// for fileno() when compiling as C99
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdlib.h>
 #include <assert.h>
 #include <stdio.h>
 
 #include "cmark_ctype.h"
 #include "config.h"
+
+#ifdef HAVE_MMAP
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
 #include "parser.h"
 #include "cmark.h"
 #include "node.h"
+#include "alloc.h"
 #include "references.h"
 #include "utf8.h"
 #include "scanners.h"
 #include "inlines.h"
 #include "houdini.h"
 #include "buffer.h"
+#include "stats.h"
+#include "trace.h"
+#include "governor.h"
 #include "debug.h"
 
 #define CODE_INDENT 4
@@ -40,7 +54,7 @@ static cmark_node* make_block(cmark_node_type tag, int start_line, int start_col
 {
     cmark_node* e;
     
-    e = (cmark_node *)calloc(1, sizeof(*e));
+    e = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*e));
     if(e != NULL) {
         e->type = tag;
         e->open = true;
@@ -71,13 +85,15 @@ void add_toc_item(cmark_node *toc,const char *label,char *link,int level)
     cmark_node *par = cmark_node_new(NODE_PARAGRAPH);
     cmark_node *url = cmark_node_new(NODE_LINK);
     cmark_node *name = cmark_node_new(NODE_TEXT);
-    cmark_chunk *chunk = calloc(1,sizeof(cmark_chunk));
-    chunk->data = malloc(sizeof(char)*100);
+    cmark_chunk *chunk = CMARK_CALLOC(OTHER, 1,sizeof(cmark_chunk));
+    chunk->data = CMARK_MALLOC(CHUNKS, sizeof(char)*100);
     sprintf((char*)chunk->data,"#%s",link);
     //additional 1 for the extra #character
     chunk->len = strlen(link)+1;
+    chunk->alloc = 1;
     url->as.link.url = *chunk;
-    new_item->user_data = malloc(sizeof(char)*40);
+    CMARK_FREE(chunk);
+    new_item->user_data = CMARK_MALLOC(OTHER, sizeof(char)*40);
     sprintf(new_item->user_data,"%d",level);
     cmark_node_set_literal(name,label);
     cmark_node_append_child(url,name);
@@ -86,6 +102,20 @@ void add_toc_item(cmark_node *toc,const char *label,char *link,int level)
     cmark_node_append_child(toc,new_item);
 }
 
+/* skip_inlines:
+ params:
+ iter: an iterator that just entered node
+ node: the node entered
+
+ The walks below only look at blocks. This makes them skip the inline content of paragraphs and headers, so that they do not parse inlines left pending by CMARK_OPT_LAZY_INLINES */
+static void skip_inlines(cmark_iter *iter, cmark_node *node)
+{
+    if(node->type==NODE_PARAGRAPH || node->type==NODE_HEADER)
+    {
+        cmark_iter_reset(iter,node,CMARK_EVENT_EXIT);
+    }
+}
+
 /*add_toc
 /params: 
  toc: the node in the AST that is of type NODE_TOC
@@ -108,7 +138,7 @@ void add_toc(cmark_node *toc, cmark_node *root,int maxDepth)
             {
                 level = node->as.header.level;
                 char *url = (char *)cmark_node_get_user_data(node);
-                cmark_node *child = node->first_child;
+                cmark_node *child = cmark_node_first_child(node);
                 while(child)
                 {
                     if(child->type==NODE_TEXT)
@@ -120,6 +150,7 @@ void add_toc(cmark_node *toc, cmark_node *root,int maxDepth)
                     child=child->next;
                 }
             }
+            skip_inlines(iter,node);
         }
     }
     cmark_iter_free(iter);
@@ -129,19 +160,25 @@ void add_toc(cmark_node *toc, cmark_node *root,int maxDepth)
 static cmark_node* make_document()
 {
     cmark_node *e = make_block(NODE_DOCUMENT, 1, 1);
+    if (e != NULL) {
+        cmark_strbuf_init(&e->as.document.input, 0);
+        e->as.document.pool = cmark_pool_new();
+    }
     return e;
 }
 
 cmark_parser *cmark_parser_new(int options)
 {
-    cmark_parser *parser = (cmark_parser*)malloc(sizeof(cmark_parser));
+    cmark_parser *parser = (cmark_parser*)CMARK_MALLOC(OTHER, sizeof(cmark_parser));
     cmark_node *document = make_document();
-    cmark_strbuf *line = (cmark_strbuf*)malloc(sizeof(cmark_strbuf));
-    cmark_strbuf *buf  = (cmark_strbuf*)malloc(sizeof(cmark_strbuf));
+    cmark_strbuf *line = (cmark_strbuf*)CMARK_MALLOC(OTHER, sizeof(cmark_strbuf));
+    cmark_strbuf *buf  = (cmark_strbuf*)CMARK_MALLOC(OTHER, sizeof(cmark_strbuf));
     cmark_strbuf_init(line, 256);
     cmark_strbuf_init(buf, 0);
     
+    document->as.document.id = cmark_trace_new_document();
     parser->refmap = cmark_reference_map_new();
+    parser->refmap->pool = document->as.document.pool;
     parser->root = document;
     parser->current = document;
     parser->line_number = 0;
@@ -149,18 +186,106 @@ cmark_parser *cmark_parser_new(int options)
     parser->last_line_length = 0;
     parser->linebuf = buf;
     parser->options = options;
+    parser->line_offset = 0;
+    parser->next_line_offset = 0;
+    parser->stats = NULL;
+    parser->governor = NULL;
+    parser->rest = NULL;
     
     return parser;
 }
 
+void cmark_parser_set_stats(cmark_parser *parser, cmark_parser_stats *stats)
+{
+    parser->stats = stats;
+    parser->root->as.document.stats = stats;
+    parser->refmap->stats = stats;
+    if (stats) {
+        stats->nodes[NODE_DOCUMENT]++;
+    }
+}
+
+void cmark_parser_set_limits(cmark_parser *parser, cmark_limits *limits)
+{
+    cmark_governor *governor = parser->governor;
+    
+    if (governor == NULL) {
+        governor = (cmark_governor *)CMARK_CALLOC(OTHER, 1, sizeof(*governor));
+        if (governor == NULL) {
+            return;
+        }
+        // the document owns it, as its renderers keep to the limits
+        parser->root->as.document.governor = governor;
+        parser->governor = governor;
+        parser->refmap->governor = governor;
+    }
+    governor->limits = limits;
+    governor->deadline = limits->max_ns ?
+                         cmark_stats_clock() + limits->max_ns : 0;
+}
+
+// Counts a reallocation of one of the parser's buffers since its
+// allocated size was 'asize', for the stats.
+static inline void S_count_realloc(cmark_parser *parser, cmark_strbuf *buf,
+                                   int asize)
+{
+    if (parser->stats && buf->asize != asize) {
+        parser->stats->buf_reallocs++;
+    }
+}
+
 void cmark_parser_free(cmark_parser *parser)
 {
     cmark_strbuf_free(parser->curline);
-    free(parser->curline);
+    CMARK_FREE(parser->curline);
     cmark_strbuf_free(parser->linebuf);
-    free(parser->linebuf);
+    CMARK_FREE(parser->linebuf);
     cmark_reference_map_free(parser->refmap);
-    free(parser);
+    CMARK_FREE(parser);
+}
+
+void cmark_parser_reset(cmark_parser *parser)
+{
+    cmark_node *root = parser->root;
+    cmark_document *doc = &root->as.document;
+    
+    while (root->first_child) {
+        cmark_node_free(root->first_child);
+    }
+    root->open = true;
+    root->last_line_blank = false;
+    root->start_line = 1;
+    root->start_column = 1;
+    root->end_line = 1;
+    root->end_column = 0;
+    root->start_offset = 0;
+    root->end_offset = 0;
+    cmark_strbuf_clear(&root->string_content);
+    
+    if (doc->refmap) {
+        // handed to the document by CMARK_OPT_LAZY_INLINES
+        parser->refmap = doc->refmap;
+        doc->refmap = NULL;
+    }
+    cmark_reference_map_clear(parser->refmap);
+    cmark_pool_clear(doc->pool);
+    cmark_strbuf_clear(&doc->input);
+    doc->options = 0;
+    doc->id = cmark_trace_new_document();
+    if (parser->governor) {
+        parser->governor->nodes = 0;
+        parser->governor->delimiters = 0;
+    }
+    
+    parser->current = root;
+    parser->line_number = 0;
+    cmark_strbuf_clear(parser->curline);
+    parser->last_line_length = 0;
+    cmark_strbuf_clear(parser->linebuf);
+    parser->line_offset = 0;
+    parser->next_line_offset = 0;
+    parser->line_verbatim = false;
+    parser->rest = NULL;
 }
 
 static cmark_node*
@@ -199,10 +324,135 @@ static inline bool accepts_lines(cmark_node_type block_type)
             block_type == NODE_CODE_BLOCK);
 }
 
-static void add_line(cmark_node* node, cmark_chunk *ch, int offset)
+static void add_line(cmark_parser *parser, cmark_node* node,
+                     cmark_chunk *ch, int offset)
 {
+    cmark_strbuf *content = &node->string_content;
+    int asize = content->asize;
+    
     assert(node->open);
-    cmark_strbuf_put(&node->string_content, ch->data + offset, ch->len - offset);
+    cmark_strbuf_put(content, ch->data + offset, ch->len - offset);
+    S_count_realloc(parser, content, asize);
+    if (parser->stats && (uint64_t)content->size > parser->stats->peak_content) {
+        parser->stats->peak_content = content->size;
+    }
+}
+
+// Moves the lines a code or HTML block recorded as slices of the
+// retained input into its string_content.
+static void copy_slices(cmark_parser *parser, cmark_node *node)
+{
+    const unsigned char *input = cmark_document_input(&parser->root->as.document);
+    cmark_slices *slices = node->slices;
+    int i;
+    
+    for (i = 0; i < slices->size; i++) {
+        int asize = node->string_content.asize;
+        
+        cmark_strbuf_put(&node->string_content,
+                         input + slices->items[i].offset,
+                         slices->items[i].len);
+        S_count_realloc(parser, &node->string_content, asize);
+    }
+    CMARK_FREE(slices->items);
+    CMARK_FREE(slices);
+    node->slices = NULL;
+}
+
+// Adds a line of a code or HTML block.  With CMARK_OPT_RETAIN_INPUT,
+// a line that is an unchanged copy of the input is recorded as a
+// slice of it instead, joined to the previous slice if they touch.
+// The block falls back to copying from its first line that is not.
+static void add_literal_line(cmark_parser *parser, cmark_node* node,
+                             cmark_chunk *ch, int offset)
+{
+    cmark_slices *slices = node->slices;
+    cmark_slice *last;
+    int start = parser->line_offset + offset;
+    int len = ch->len - offset;
+    
+    if (!(parser->options & CMARK_OPT_RETAIN_INPUT) ||
+        cmark_strbuf_len(&node->string_content) > 0) {
+        add_line(parser, node, ch, offset);
+        return;
+    }
+    
+    if (parser->line_verbatim) {
+        if (slices == NULL) {
+            slices = node->slices =
+                (cmark_slices *)CMARK_CALLOC(OTHER, 1, sizeof(*slices));
+        }
+        if (slices && slices->size > 0) {
+            last = &slices->items[slices->size - 1];
+            if (last->offset + last->len == start) {
+                last->len += len;
+                return;
+            }
+        }
+        if (slices && slices->size == slices->asize) {
+            int asize = slices->asize ? 2 * slices->asize : 8;
+            cmark_slice *items = (cmark_slice *)CMARK_REALLOC(OTHER,
+                                     slices->items, asize * sizeof(*items));
+            if (items != NULL) {
+                slices->items = items;
+                slices->asize = asize;
+            }
+        }
+        if (slices && slices->size < slices->asize) {
+            slices->items[slices->size].offset = start;
+            slices->items[slices->size].len = len;
+            slices->size++;
+            return;
+        }
+    }
+    
+    // not a copy of the input (or out of memory): copy from now on
+    if (slices) {
+        copy_slices(parser, node);
+    }
+    add_line(parser, node, ch, offset);
+}
+
+// Like remove_trailing_blank_lines, for an indented code block kept
+// as slices; every slice ends with a newline.
+static void remove_trailing_blank_slices(cmark_parser *parser,
+                                         cmark_node *node)
+{
+    const unsigned char *data = cmark_document_input(&parser->root->as.document);
+    cmark_slices *slices = node->slices;
+    cmark_slice *slice;
+    const unsigned char *eol;
+    int i, j;
+    
+    for (i = slices->size - 1; i >= 0; --i) {
+        slice = &slices->items[i];
+        for (j = slice->offset + slice->len - 1; j >= slice->offset; --j) {
+            unsigned char c = data[j];
+            
+            if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+                // keep the rest of this line, up to its newline
+                eol = (const unsigned char *)memchr(data + j, '\n',
+                                                    slice->offset + slice->len - j);
+                slice->len = eol + 1 - (data + slice->offset);
+                slices->size = i + 1;
+                return;
+            }
+        }
+    }
+    slices->size = 0;
+}
+
+// The rest of the line that opens a fenced code block is its info
+// string.
+static void set_fence_info(cmark_node *node, cmark_chunk *ch, int offset)
+{
+    cmark_strbuf tmp = GH_BUF_INIT;
+    int eol = cmark_chunk_strchr(ch, '\n', offset);
+    
+    houdini_unescape_html_f(&tmp, ch->data + offset, eol - offset);
+    cmark_strbuf_trim(&tmp);
+    cmark_strbuf_unescape(&tmp);
+    node->as.code.info = cmark_chunk_buf_detach(&tmp);
 }
 
 static void remove_trailing_blank_lines(cmark_strbuf *ln)
@@ -267,11 +517,12 @@ static int break_out_of_lists(cmark_parser *parser, cmark_node ** bptr)
 static cmark_node*
 finalize(cmark_parser *parser, cmark_node* b)
 {
-    int firstlinelen;
     int pos;
+    int len;
     cmark_node* item;
     cmark_node* subitem;
     cmark_node* parent;
+    uint64_t start = cmark_stats_start(parser->stats);
     
     parent = b->parent;
     
@@ -282,6 +533,7 @@ finalize(cmark_parser *parser, cmark_node* b)
         // end of input - line number has not been incremented
         b->end_line = parser->line_number;
         b->end_column = parser->last_line_length;
+        b->end_offset = parser->next_line_offset;
     } else if (b->type == NODE_DOCUMENT ||
                (b->type == NODE_CODE_BLOCK && b->as.code.fenced) ||
                (b->type == NODE_HEADER && b->as.header.setext)) {
@@ -289,77 +541,77 @@ finalize(cmark_parser *parser, cmark_node* b)
         b->end_column = parser->curline->size -
         (parser->curline->ptr[parser->curline->size - 1] == '\n' ?
          1 : 0);
+        b->end_offset = parser->next_line_offset;
     } else {
         b->end_line = parser->line_number - 1;
         b->end_column = parser->last_line_length;
+        b->end_offset = parser->line_offset;
     }
     
     switch (b->type) {
         case NODE_PARAGRAPH:
+            // definitions are consumed by moving 'pos' past them; the
+            // text after them is moved to the front once, at the end
+            pos = 0;
             if(cmark_strbuf_at(&b->string_content,0)=='[')
             {
-                while (cmark_strbuf_at(&b->string_content, 0) == '[' &&
-                       (pos = cmark_parse_reference_inline(&b->string_content, parser->refmap))) {
-                    cmark_strbuf_drop(&b->string_content, pos);
-                }
-                if (is_blank(&b->string_content, 0)) {
-                    // remove blank node (former reference def)
-                    cmark_node_free(b);
+                // definitions are ordered by the block they appear in
+                parser->refmap->origin = b->start_offset;
+                while (cmark_strbuf_at(&b->string_content, pos) == '[' &&
+                       (len = cmark_parse_reference_inline(&b->string_content, pos, parser->refmap))) {
+                    pos += len;
                 }
             }
             else if(cmark_strbuf_at(&b->string_content,0)=='<' && cmark_strbuf_at(&b->string_content,1)=='<')
             {
-                while(cmark_strbuf_at(&b->string_content,0)=='<' && cmark_strbuf_at(&b->string_content,1)=='<' && (pos = cmark_parse_include_inline(&b->string_content,parser)))
-                {
-                    cmark_strbuf_drop(&b->string_content,pos);
-                }
-                if(is_blank(&b->string_content,0))
+                while(cmark_strbuf_at(&b->string_content,pos)=='<' && cmark_strbuf_at(&b->string_content,pos+1)=='<' && (len = cmark_parse_include_inline(&b->string_content,pos,parser)))
                 {
-                    cmark_node_free(b);
+                    pos += len;
                 }
             }
             //check if you've encountered a { to start parsing for the {toc}
             else if(cmark_strbuf_at(&b->string_content,0)=='{')
             {
                 //parse_toc_inline is in inlines.c
-                while(cmark_strbuf_at(&b->string_content,0)=='{' && (pos = cmark_parse_toc_inline(&b->string_content,parser)))
+                while(cmark_strbuf_at(&b->string_content,pos)=='{' && (len = cmark_parse_toc_inline(&b->string_content,pos,parser)))
                 {
-                    //if successfully passed, drop it from the string_content of the node so that it doesn't get added as a paragraph. All the text in a paragraph node is stored in a node's string_content before its processed into text nodes
-                    cmark_strbuf_drop(&b->string_content,pos);
+                    //if successfully passed, skip it in the string_content of the node so that it doesn't get added as a paragraph. All the text in a paragraph node is stored in a node's string_content before its processed into text nodes
+                    pos += len;
                 }
-                if(is_blank(&b->string_content,0))
-                {
+            }
+            if (pos > 0) {
+                if (is_blank(&b->string_content, pos)) {
+                    // remove blank node (former definitions)
                     cmark_node_free(b);
+                } else {
+                    cmark_strbuf_drop(&b->string_content, pos);
                 }
             }
             break;
             
         case NODE_CODE_BLOCK:
+            // the info string of fenced code was set by set_fence_info
+            if (!b->as.code.fenced && b->slices) {
+                remove_trailing_blank_slices(parser, b);
+                if (b->slices->size == 0) {
+                    copy_slices(parser, b);
+                }
+            }
+            if (b->slices) {
+                // the literal is joined when first needed
+                break;
+            }
             if (!b->as.code.fenced) { // indented code
                 remove_trailing_blank_lines(&b->string_content);
                 cmark_strbuf_putc(&b->string_content, '\n');
-            } else {
-                
-                // first line of contents becomes info
-                firstlinelen = cmark_strbuf_strchr(&b->string_content, '\n', 0);
-                
-                cmark_strbuf tmp = GH_BUF_INIT;
-                houdini_unescape_html_f(
-                                        &tmp,
-                                        b->string_content.ptr,
-                                        firstlinelen
-                                        );
-                cmark_strbuf_trim(&tmp);
-                cmark_strbuf_unescape(&tmp);
-                b->as.code.info = cmark_chunk_buf_detach(&tmp);
-                
-                cmark_strbuf_drop(&b->string_content, firstlinelen + 1);
             }
             b->as.code.literal = cmark_chunk_buf_detach(&b->string_content);
             break;
             
         case NODE_HTML:
-            b->as.literal = cmark_chunk_buf_detach(&b->string_content);
+            if (!b->slices) {
+                b->as.literal = cmark_chunk_buf_detach(&b->string_content);
+            }
             break;
             
         case NODE_LIST: // determine tight/loose status
@@ -373,11 +625,13 @@ finalize(cmark_parser *parser, cmark_node* b)
                     break;
                 }
                 // recurse into children of list item, to see if there are
-                // spaces between them:
+                // spaces between them.  ends_with_blank_line descends
+                // through nested lists, so it is only asked when it
+                // matters; otherwise deep nesting is quadratic
                 subitem = item->first_child;
                 while (subitem) {
-                    if (ends_with_blank_line(subitem) &&
-                        (item->next || subitem->next)) {
+                    if ((item->next || subitem->next) &&
+                        ends_with_blank_line(subitem)) {
                         b->as.list.tight = false;
                         break;
                     }
@@ -394,6 +648,7 @@ finalize(cmark_parser *parser, cmark_node* b)
         default:
             break;
     }
+    cmark_stats_end(parser->stats, finalize_ns, start);
     return parent;
 }
 
@@ -411,6 +666,11 @@ static cmark_node* add_child(cmark_parser *parser, cmark_node* parent,
     
     cmark_node* child = make_block(block_type, parser->line_number, start_column);
     child->parent = parent;
+    if (parser->stats) {
+        parser->stats->nodes[block_type]++;
+    }
+    cmark_governor_count_node(parser->governor);
+    child->start_offset = parser->line_offset;
     
     if (parent->last_child) {
         parent->last_child->next = child;
@@ -437,7 +697,11 @@ static void process_inlines(cmark_node* root, cmark_reference_map *refmap, int o
         if (ev_type == CMARK_EVENT_ENTER) {
             if (cur->type == NODE_PARAGRAPH ||
                 cur->type == NODE_HEADER) {
-                cmark_parse_inlines(cur, refmap, options);
+                if (options & CMARK_OPT_LAZY_INLINES) {
+                    cur->pending_inlines = true;
+                } else {
+                    cmark_parse_inlines(cur, refmap, options);
+                }
             }
         }
     }
@@ -445,70 +709,6 @@ static void process_inlines(cmark_node* root, cmark_reference_map *refmap, int o
     cmark_iter_free(iter);
 }
 
-// Attempts to parse a list item marker (bullet or enumerated).
-// On success, returns length of the marker, and populates
-// data with the details.  On failure, returns 0.
-static int parse_list_marker(cmark_chunk *input, int pos, cmark_list **dataptr)
-{
-    unsigned char c;
-    int startpos;
-    cmark_list *data;
-    
-    startpos = pos;
-    c = peek_at(input, pos);
-    
-    if (c == '*' || c == '-' || c == '+') {
-        pos++;
-        if (!cmark_isspace(peek_at(input, pos))) {
-            return 0;
-        }
-        data = (cmark_list *)calloc(1, sizeof(*data));
-        if(data == NULL) {
-            return 0;
-        } else {
-            data->marker_offset = 0; // will be adjusted later
-            data->list_type = CMARK_BULLET_LIST;
-            data->bullet_char = c;
-            data->start = 1;
-            data->delimiter = CMARK_PERIOD_DELIM;
-            data->tight = false;
-        }
-    } else if (cmark_isdigit(c)) {
-        int start = 0;
-        
-        do {
-            start = (10 * start) + (peek_at(input, pos) - '0');
-            pos++;
-        } while (cmark_isdigit(peek_at(input, pos)));
-        
-        c = peek_at(input, pos);
-        if (c == '.' || c == ')') {
-            pos++;
-            if (!cmark_isspace(peek_at(input, pos))) {
-                return 0;
-            }
-            data = (cmark_list *)calloc(1, sizeof(*data));
-            if(data == NULL) {
-                return 0;
-            } else {
-                data->marker_offset = 0; // will be adjusted later
-                data->list_type = CMARK_ORDERED_LIST;
-                data->bullet_char = 0;
-                data->start = start;
-                data->delimiter = (c == '.' ? CMARK_PERIOD_DELIM : CMARK_PAREN_DELIM);
-                data->tight = false;
-            }
-        } else {
-            return 0;
-        }
-        
-    } else {
-        return 0;
-    }
-    *dataptr = data;
-    return (pos - startpos);
-}
-
 // Return 1 if list item belongs in list, else 0.
 static int lists_match(cmark_list *list_data, cmark_list *item_data)
 {
@@ -527,18 +727,23 @@ cmark_node *add_body(cmark_node *root)
         exit(1);
     }
     assert(root->type==NODE_DOCUMENT);
-    if(root->first_child->type==NODE_HEAD)
+    if(root->first_child && root->first_child->type==NODE_HEAD)
     {
         cmark_node *head = root->first_child;
         cmark_node_unlink(root->first_child);
         root->type = NODE_BODY;
         cmark_node *new_root = cmark_node_new(NODE_DOCUMENT);
+        // the retained input belongs to the document node
+        new_root->as.document = root->as.document;
+        cmark_strbuf_init(&root->as.document.input, 0);
+        root->as.document.pool = NULL;
         cmark_node_append_child(new_root,root);
         //reset the parameters of the old document
         new_root->start_line = root->start_line;
         new_root->start_column = root->start_column;
         new_root->end_line = root->end_line;
         new_root->end_column = root->end_column;
+        new_root->end_offset = root->end_offset;
         new_root->open = root->open;
         new_root->last_line_blank = root->last_line_blank;
         cmark_node_prepend_child(new_root,head);
@@ -570,11 +775,14 @@ void add_header_links(cmark_node *root,int maxDepth)
                   cmark_node *node = cmark_iter_get_node(iter);
                   if(node->type==NODE_HEADER && node->as.header.level<=maxDepth)
                   {
-                      char *user_data = malloc(sizeof(char)*40);
+                      //drop the id from a previous run
+                      CMARK_FREE(node->user_data);
+                      char *user_data = CMARK_MALLOC(OTHER, sizeof(char)*40);
                       sprintf(user_data,"toc%d",count);
                       cmark_node_set_user_data(node,user_data);
                       count+=1;
                   }
+                  skip_inlines(iter,node);
               }
           }
     cmark_iter_free(iter);
@@ -600,52 +808,175 @@ cmark_node *toc_present(cmark_node *root)
                 cmark_iter_free(iter);
                 return node;
             }
+            skip_inlines(iter,node);
         }
     }
     cmark_iter_free(iter);
     return NULL;
 }
 
-static cmark_node *finalize_document(cmark_parser *parser)
+/* update_toc:
+    params:
+    root: root node of AST */
+
+/* Fills in the table of contents, if there is one, from the headers of the document. Entries from a previous run are removed first, so this can be called again after the document changed */
+void update_toc(cmark_node *root)
 {
     cmark_node *toc;
-    while (parser->current != parser->root) {
-        parser->current = finalize(parser, parser->current);
-    }
-    finalize(parser, parser->root);
-    process_inlines(parser->root, parser->refmap, parser->options);
-    /*Add a body in case << syntax was used to include files. This is necessary because the <link> tags to include the files were placed inside a head tag. so we place the rest of the content inside a body tag
-     */
-    parser->root = add_body(parser->root);
-    if((toc = toc_present(parser->root))!=NULL)
+    if((toc = toc_present(root))!=NULL)
     {
         int maxDepth = atoi(cmark_node_get_user_data(toc));
         if(maxDepth == -1)
         {
             maxDepth = 10; //allows upto h10
         }
+        while(toc->first_child)
+        {
+            //the level string of the item
+            CMARK_FREE(toc->first_child->user_data);
+            cmark_node_free(toc->first_child);
+        }
         //go to all the valid headers and populate their user_data field
-        add_header_links(parser->root,maxDepth);
+        add_header_links(root,maxDepth);
         //add the children to the toc_node as node_items
-        add_toc(toc,parser->root,maxDepth);
+        add_toc(toc,root,maxDepth);
     }
+}
+
+static cmark_node *finalize_document(cmark_parser *parser)
+{
+    uint64_t start;
+    
+    while (parser->current != parser->root) {
+        parser->current = finalize(parser, parser->current);
+    }
+    finalize(parser, parser->root);
+    if (!(parser->options & CMARK_OPT_BLOCKS_ONLY)) {
+        cmark_trace_begin(INLINES, parser->root->as.document.id,
+                          parser->next_line_offset, parser->stats);
+        start = cmark_stats_start(parser->stats);
+        process_inlines(parser->root, parser->refmap, parser->options);
+        cmark_stats_end(parser->stats, inlines_ns, start);
+        cmark_trace_end(INLINES, parser->root->as.document.id,
+                        parser->next_line_offset, parser->stats);
+    }
+    if (parser->options & CMARK_OPT_LAZY_INLINES) {
+        // the references are needed until the last inlines are parsed
+        parser->root->as.document.refmap = parser->refmap;
+        parser->root->as.document.options = parser->options;
+        parser->refmap = NULL;
+    }
+    /*Add a body in case << syntax was used to include files. This is necessary because the <link> tags to include the files were placed inside a head tag. so we place the rest of the content inside a body tag
+     */
+    cmark_trace_begin(POSTPROCESS, parser->root->as.document.id,
+                      parser->next_line_offset, parser->stats);
+    start = cmark_stats_start(parser->stats);
+    parser->root = add_body(parser->root);
+    update_toc(parser->root);
+    cmark_stats_end(parser->stats, postprocess_ns, start);
+    cmark_trace_end(POSTPROCESS, parser->root->as.document.id,
+                    parser->next_line_offset, parser->stats);
     return parser->root;
 }
 
-cmark_node *cmark_parse_file(FILE *f, int options)
+#define READ_SIZE 65536
+
+// Appends fed input to the copy kept by CMARK_OPT_RETAIN_INPUT.
+static void S_retain_input(cmark_parser *parser, const unsigned char *buffer,
+                           size_t len)
 {
-    unsigned char buffer[4096];
-    cmark_parser *parser = cmark_parser_new(options);
+    cmark_document *doc = &parser->root->as.document;
+    
+    if (doc->map != NULL && buffer == doc->map) {
+        // a mapped file, kept as it is
+        return;
+    }
+#ifdef HAVE_MMAP
+    if (doc->map != NULL) {
+        // more input after a mapped file: copy both
+        cmark_strbuf_put(&doc->input, doc->map, doc->map_len);
+        munmap(doc->map, doc->map_len);
+        doc->map = NULL;
+    }
+#endif
+    cmark_strbuf_put(&doc->input, buffer, len);
+}
+
+#ifdef HAVE_MMAP
+// Maps a regular file that has not been read from yet and feeds it
+// whole, so that lines are parsed in place.  Returns false if the file
+// has to be read instead.
+static bool S_parser_map_file(cmark_parser *parser, FILE *f, bool eof)
+{
+    struct stat st;
+    void *map;
+    size_t len;
+    int fd = fileno(f);
+    
+    if (fd < 0 || ftell(f) != 0 || fstat(fd, &st) != 0 ||
+        !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (uintmax_t)st.st_size > SIZE_MAX) {
+        return false;
+    }
+    len = (size_t)st.st_size;
+    map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+#ifdef POSIX_MADV_SEQUENTIAL
+    posix_madvise(map, len, POSIX_MADV_SEQUENTIAL);
+#endif
+    if ((parser->options & CMARK_OPT_RETAIN_INPUT) &&
+        parser->next_line_offset == 0 && parser->linebuf->size == 0 &&
+        parser->root->as.document.map == NULL) {
+        // the document keeps the mapping as its input
+        parser->root->as.document.map = (unsigned char *)map;
+        parser->root->as.document.map_len = len;
+        S_parser_feed(parser, (const unsigned char *)map, len, eof);
+    } else {
+        S_parser_feed(parser, (const unsigned char *)map, len, eof);
+        munmap(map, len);
+    }
+    fseek(f, 0, SEEK_END);
+    return true;
+}
+#endif
+
+static void S_parser_feed_file(cmark_parser *parser, FILE *f, bool eof)
+{
+    unsigned char *buffer;
     size_t bytes;
-    cmark_node *document;
     
-    while ((bytes = fread(buffer, 1, sizeof(buffer), f)) > 0) {
-        bool eof = bytes < sizeof(buffer);
-        S_parser_feed(parser, buffer, bytes, eof);
-        if (eof) {
+#ifdef HAVE_MMAP
+    if (S_parser_map_file(parser, f, eof)) {
+        return;
+    }
+#endif
+    buffer = (unsigned char *)CMARK_MALLOC(OTHER, READ_SIZE);
+    if (buffer == NULL) {
+        return;
+    }
+    while ((bytes = fread(buffer, 1, READ_SIZE, f)) > 0) {
+        bool last = bytes < READ_SIZE;
+        S_parser_feed(parser, buffer, bytes, eof && last);
+        if (last) {
             break;
         }
     }
+    CMARK_FREE(buffer);
+}
+
+void cmark_parser_feed_file(cmark_parser *parser, FILE *f)
+{
+    S_parser_feed_file(parser, f, false);
+}
+
+cmark_node *cmark_parse_file(FILE *f, int options)
+{
+    cmark_parser *parser = cmark_parser_new(options);
+    cmark_node *document;
+    
+    S_parser_feed_file(parser, f, true);
     
     document = cmark_parser_finish(parser);
     cmark_parser_free(parser);
@@ -664,6 +995,65 @@ cmark_node *cmark_parse_document(const char *buffer, size_t len, int options)
     return document;
 }
 
+cmark_node *cmark_parse_document_head(const char *buffer, size_t len,
+                                      int options, int max_blocks,
+                                      size_t max_bytes, int *blocks)
+{
+    cmark_parser *parser = cmark_parser_new(options);
+    const unsigned char *p = (const unsigned char *)buffer;
+    const unsigned char *end = p + len;
+    cmark_node *last = NULL;  // last closed top-level block
+    cmark_node *document;
+    size_t open_start, open_len;
+    int closed = 0;
+    
+    *blocks = max_blocks;
+    while (p < end) {
+        const unsigned char *eol = (const unsigned char *)memchr(p, '\n',
+                                                                 end - p);
+        size_t line_len = eol ? (size_t)(eol + 1 - p) : (size_t)(end - p);
+        cmark_node *b;
+        
+        // no more of the open block is read than would fill the preview
+        // (the renderer cuts it), even within a line, which is cut at the
+        // start of a UTF-8 sequence
+        open_start = last ? (size_t)last->end_offset : 0;
+        open_len = (size_t)(p - (const unsigned char *)buffer);
+        open_len = open_len > open_start ? open_len - open_start : 0;
+        if (max_bytes > 0 && open_len + line_len > max_bytes + 1) {
+            line_len = open_len <= max_bytes ? max_bytes + 1 - open_len : 0;
+            while (line_len > 1 && (p[line_len] & 0xC0) == 0x80) {
+                line_len--;
+            }
+            S_parser_feed(parser, p, line_len, true);
+            break;
+        }
+        S_parser_feed(parser, p, line_len, true);
+        p += line_len;
+        
+        // a block is closed once a line that does not belong to it is
+        // seen; the open one may still grow
+        for (b = last ? last->next : parser->root->first_child;
+             b != NULL && !b->open; b = b->next) {
+            last = b;
+            if (b->type != NODE_HEAD) {
+                closed++;
+            }
+        }
+        if (p < end &&
+            ((max_blocks > 0 && closed >= max_blocks) ||
+             (max_bytes > 0 && last != NULL &&
+              (size_t)last->end_offset >= max_bytes))) {
+            *blocks = closed;
+            break;
+        }
+    }
+    
+    document = cmark_parser_finish(parser);
+    cmark_parser_free(parser);
+    return document;
+}
+
 void
 cmark_parser_feed(cmark_parser *parser, const char *buffer, size_t len)
 {
@@ -675,12 +1065,22 @@ S_parser_feed(cmark_parser *parser, const unsigned char *buffer, size_t len,
               bool eof)
 {
     const unsigned char *end = buffer + len;
+    cmark_parser_stats *stats = parser->stats;
+    uint64_t finalized = stats ? stats->finalize_ns : 0;
+    uint64_t start = cmark_stats_start(stats);
+    
+    cmark_trace_begin(LINES, parser->root->as.document.id,
+                      parser->next_line_offset, stats);
+    if (parser->options & CMARK_OPT_RETAIN_INPUT) {
+        S_retain_input(parser, buffer, len);
+    }
     
     while (buffer < end) {
         const unsigned char *eol
         = (const unsigned char *)memchr(buffer, '\n',
                                         end - buffer);
         size_t line_len;
+        int asize = parser->linebuf->asize;
         
         if (eol) {
             line_len = eol + 1 - buffer;
@@ -688,12 +1088,14 @@ S_parser_feed(cmark_parser *parser, const unsigned char *buffer, size_t len,
             line_len = end - buffer;
         } else {
             cmark_strbuf_put(parser->linebuf, buffer, end - buffer);
+            S_count_realloc(parser, parser->linebuf, asize);
             break;
         }
         
         //parser->linebuf will be empty unless you have a string of 4096 characters without a new line or an end of file. Enter this if statement if you need encountered new line character in second parse
         if (parser->linebuf->size > 0) {
             cmark_strbuf_put(parser->linebuf, buffer, line_len);
+            S_count_realloc(parser, parser->linebuf, asize);
             S_process_line(parser, parser->linebuf->ptr,
                            parser->linebuf->size);
             cmark_strbuf_clear(parser->linebuf);
@@ -703,6 +1105,10 @@ S_parser_feed(cmark_parser *parser, const unsigned char *buffer, size_t len,
         
         buffer += line_len;
     }
+    // blocks closed by the lines were timed by finalize
+    cmark_stats_end(stats, lines_ns, start + (stats->finalize_ns - finalized));
+    cmark_trace_end(LINES, parser->root->as.document.id,
+                    parser->next_line_offset, stats);
 }
 
 static void chop_trailing_hashtags(cmark_chunk *ch)
@@ -723,30 +1129,261 @@ static void chop_trailing_hashtags(cmark_chunk *ch)
     }
 }
 
+// Kinds of block start found by S_scan_block_start.
+#define START_ATX     1
+#define START_FENCE   2
+#define START_HTML    4
+#define START_SETEXT  8
+#define START_HRULE  16
+#define START_LIST   32
+
+// Everything the block starts of one line need to know, filled in
+// by a single pass over the line.
+typedef struct {
+    int kinds;          // START_* bits of the block starts that match
+    int atx_length;     // "#"s and the spaces after them
+    int atx_level;
+    int fence_length;
+    int setext_level;
+    int list_length;    // length of the list marker
+    cmark_list list;
+    // kept across the calls for one line: a run of 'miss_char's and
+    // spaces from 'miss_start' to 'miss_end' that is followed by
+    // something else, so no hrule starts inside it.  Nested list
+    // markers ("- - - a") would otherwise rescan it once per marker
+    int miss_start;
+    int miss_end;
+    unsigned char miss_char;
+} block_start;
+
+// Classifies the block starts possible at 'pos', which must be the
+// first non-space byte of a line ending in '\n'.  Matches the same
+// lines as scan_atx_header_start, scan_open_code_fence,
+// scan_html_block_tag, scan_setext_header_line and scan_hrule, and
+// the list markers recognized by the spec, but reads the line only
+// once.  A line can match several kinds ("---" is both a setext
+// underline and an hrule); S_process_line decides between them.
+static void S_scan_block_start(cmark_chunk *input, int pos, block_start *bs)
+{
+    const unsigned char *start = input->data + pos;
+    const unsigned char *end = input->data + input->len;
+    const unsigned char *p = start;
+    unsigned char c = *p;
+    int n = 0;
+    
+    bs->kinds = 0;
+    
+    switch (c) {
+        case '#':
+            while (p < end && *p == '#')
+                p++;
+            n = p - start;
+            if (n > 6 || p == end) {
+                break;
+            } else if (*p == '\n') {
+                bs->kinds = START_ATX;
+                bs->atx_length = n + 1;
+                bs->atx_level = n;
+            } else if (*p == ' ') {
+                while (p < end && *p == ' ')
+                    p++;
+                bs->kinds = START_ATX;
+                bs->atx_length = p - start;
+                bs->atx_level = n;
+            }
+            break;
+            
+        case '`':
+        case '~':
+            while (p < end && *p == c)
+                p++;
+            n = p - start;
+            if (n < 3)
+                break;
+            // the rest of the line may not contain the fence char
+            while (p < end && *p != '\n' && *p != c && *p != 0)
+                p++;
+            if (p < end && *p == '\n') {
+                bs->kinds = START_FENCE;
+                bs->fence_length = n;
+            }
+            break;
+            
+        case '<':
+            if (scan_html_block_tag(input, pos))
+                bs->kinds = START_HTML;
+            break;
+            
+        case '=':
+        case '-':
+        case '*':
+        case '_':
+        case '+':
+            if (c != '=' && c != '_' && cmark_isspace(start[1])) {
+                bs->kinds = START_LIST;
+                bs->list_length = 1;
+                bs->list.list_type = CMARK_BULLET_LIST;
+                bs->list.bullet_char = c;
+                bs->list.start = 1;
+                bs->list.delimiter = CMARK_PERIOD_DELIM;
+            }
+            if (c == '+')
+                break;
+            // a setext underline is one run of the char, an hrule
+            // three or more of them, possibly separated by spaces;
+            // either may be followed by trailing spaces
+            while (p < end && *p == c)
+                p++;
+            n = p - start;
+            if (c == '=' || c == '-') {
+                const unsigned char *q = p;
+                while (q < end && *q == ' ')
+                    q++;
+                if (q < end && *q == '\n') {
+                    bs->kinds |= START_SETEXT;
+                    bs->setext_level = c == '=' ? 1 : 2;
+                }
+            }
+            if (c == '=')
+                break;
+            if (c == bs->miss_char && pos >= bs->miss_start &&
+                pos < bs->miss_end)
+                break;
+            while (p < end && (*p == c || *p == ' ')) {
+                if (*p == c)
+                    n++;
+                p++;
+            }
+            while (p < end && (*p == ' ' || *p == '\t'))
+                p++;
+            if (p < end && *p == '\n') {
+                if (n >= 3)
+                    bs->kinds |= START_HRULE;
+            } else {
+                bs->miss_start = pos;
+                bs->miss_end = p - input->data;
+                bs->miss_char = c;
+            }
+            break;
+            
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            do {
+                n = (10 * n) + (*p - '0');
+                p++;
+            } while (p < end && cmark_isdigit(*p));
+            if (p + 1 < end && (*p == '.' || *p == ')') &&
+                cmark_isspace(p[1])) {
+                bs->kinds = START_LIST;
+                bs->list_length = p + 1 - start;
+                bs->list.list_type = CMARK_ORDERED_LIST;
+                bs->list.bullet_char = 0;
+                bs->list.start = n;
+                bs->list.delimiter = *p == '.' ? CMARK_PERIOD_DELIM
+                                               : CMARK_PAREN_DELIM;
+            }
+            break;
+            
+        default:
+            break;
+    }
+    
+    if (bs->kinds & START_LIST) {
+        bs->list.marker_offset = 0; // will be adjusted later
+        bs->list.padding = 0;
+        bs->list.tight = false;
+    }
+}
+
+// The run of spaces last found on the current line.  Every offset
+// in [start, end] has its first non-space byte at 'end', so the
+// container loops of S_process_line, which keep asking from offsets
+// inside the same run, only scan each space once per line.
+typedef struct {
+    int start;
+    int end;
+} space_run;
+
+static inline int
+S_find_first_nonspace(cmark_chunk *input, space_run *spaces, int offset)
+{
+    if (offset < spaces->start || offset > spaces->end) {
+        spaces->start = offset;
+        spaces->end = offset;
+        while (peek_at(input, spaces->end) == ' ')
+            spaces->end++;
+    }
+    return spaces->end;
+}
+
+// Once a limit stops the parse, the lines left go to one paragraph at
+// the end of the document, whose inlines are all text.
+static void S_add_rest_line(cmark_parser *parser, cmark_chunk *input)
+{
+    if (parser->rest == NULL) {
+        while (parser->current != parser->root) {
+            parser->current = finalize(parser, parser->current);
+        }
+        parser->rest = add_child(parser, parser->root, NODE_PARAGRAPH, 1);
+        parser->current = parser->rest;
+    }
+    add_line(parser, parser->rest, input, 0);
+}
+
+// Returns true if no block may be opened in 'container'.  The walk up
+// stops at the limit, so the check costs at most max_depth steps.
+static bool S_too_deep(cmark_parser *parser, cmark_node *container)
+{
+    cmark_governor *governor = parser->governor;
+    int depth = 0;
+    
+    if (governor == NULL || governor->limits->max_depth <= 0) {
+        return false;
+    }
+    for (; container->parent; container = container->parent) {
+        if (++depth >= governor->limits->max_depth) {
+            governor->limits->exceeded |= CMARK_LIMIT_DEPTH;
+            return true;
+        }
+    }
+    return false;
+}
+
 static void
 S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
 {
     cmark_node* last_matched_container;
     int offset = 0;
     int matched = 0;
-    int lev = 0;
     int i;
-    cmark_list *data = NULL;
     bool all_matched = true;
     cmark_node* container;
     bool blank = false;
     int first_nonspace;
     int indent;
+    block_start start;
+    space_run spaces = { -1, -1 };
     cmark_chunk input;
     bool maybe_lazy;
+    int asize = parser->curline->asize;
+    
+    start.miss_char = 0;
+    parser->line_offset = parser->next_line_offset;
+    parser->next_line_offset += bytes;
+    if (parser->stats) {
+        parser->stats->lines++;
+        parser->stats->bytes += bytes;
+    }
     
     //utf8proc_detab will replace tabs with 4 spaces and add the string in buffer to parser->curline
-    utf8proc_detab(parser->curline, buffer, bytes);
+    parser->line_verbatim = utf8proc_detab(parser->curline, buffer, bytes);
     // Add a newline to the end if not present:
     // TODO this breaks abstraction:
     if (parser->curline->ptr[parser->curline->size - 1] != '\n') {
         cmark_strbuf_putc(parser->curline, '\n');
+        parser->line_verbatim = false;
     }
+    S_count_realloc(parser, parser->curline, asize);
     input.data = parser->curline->ptr;
     input.len = parser->curline->size;
     
@@ -755,6 +1392,11 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
     
     parser->line_number++;
     
+    if (cmark_governor_parse_stopped(parser->governor)) {
+        S_add_rest_line(parser, &input);
+        goto finished;
+    }
+    
     // for each containing node, try to parse the associated line start.
     // bail out on failure:  container will point to the last matching node.
     
@@ -763,10 +1405,7 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
     while (container->last_child && container->last_child->open) {
         container = container->last_child;
         
-        first_nonspace = offset;
-        while (peek_at(&input, first_nonspace) == ' ') {
-            first_nonspace++;
-        }
+        first_nonspace = S_find_first_nonspace(&input, &spaces, offset);
         
         indent = first_nonspace - offset;
         blank = peek_at(&input, first_nonspace) == '\n';
@@ -862,13 +1501,15 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
     // try new container starts:
     while (container->type != NODE_CODE_BLOCK &&
            container->type != NODE_HTML) {
+        if (S_too_deep(parser, container)) {
+            break;
+        }
         //first_nonspace has to be set selectively in each case
-        first_nonspace = offset;
-        while (peek_at(&input, first_nonspace) == ' ')
-            first_nonspace++;
+        first_nonspace = S_find_first_nonspace(&input, &spaces, offset);
         
         indent = first_nonspace - offset;
         blank = peek_at(&input, first_nonspace) == '\n';
+        S_scan_block_start(&input, first_nonspace, &start);
         
         if (indent >= CODE_INDENT) {
             if (!maybe_lazy && !blank) {
@@ -891,30 +1532,23 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
                 offset++;
             container = add_child(parser, container, NODE_BLOCK_QUOTE, offset + 1);
             
-        } else if ((matched = scan_atx_header_start(&input, first_nonspace))) {
-            offset = first_nonspace + matched;
+        } else if (start.kinds & START_ATX) {
+            offset = first_nonspace + start.atx_length;
             container = add_child(parser, container, NODE_HEADER, offset + 1);
-            int hashpos = cmark_chunk_strchr(&input, '#', first_nonspace);
-            int level = 0;
-            
-            while (peek_at(&input, hashpos) == '#') {
-                level++;
-                hashpos++;
-            }
-            container->as.header.level = level;
+            container->as.header.level = start.atx_level;
             container->as.header.setext = false;
             
-        } else if ((matched = scan_open_code_fence(&input, first_nonspace))) {
+        } else if (start.kinds & START_FENCE) {
             
             container = add_child(parser, container, NODE_CODE_BLOCK, first_nonspace + 1);
             container->as.code.fenced = true;
             container->as.code.fence_char = peek_at(&input, first_nonspace);
-            container->as.code.fence_length = matched;
+            container->as.code.fence_length = start.fence_length;
             container->as.code.fence_offset = first_nonspace - offset;
             container->as.code.info = cmark_chunk_literal("");
-            offset = first_nonspace + matched;
+            offset = first_nonspace + start.fence_length;
             
-        } else if ((matched = scan_html_block_tag(&input, first_nonspace))) {
+        } else if (start.kinds & START_HTML) {
             
             container = add_child(parser, container, NODE_HTML, first_nonspace + 1);
             // note, we don't adjust offset because the tag is part of the text
@@ -922,25 +1556,28 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
             // header
             //-----/======
             //previously encountered the text so now parse the ==== and set the header fields
-        } else if (container->type == NODE_PARAGRAPH &&
-                   (lev = scan_setext_header_line(&input, first_nonspace)) &&
+        } else if ((start.kinds & START_SETEXT) &&
+                   container->type == NODE_PARAGRAPH &&
                    // check that there is only one line in the paragraph:
                    cmark_strbuf_strrchr(&container->string_content, '\n',cmark_strbuf_len(&container->string_content) - 2) < 0) {
                        //because header can contain only 1 line
                        container->type = NODE_HEADER;
-                       container->as.header.level = lev;
+                       container->as.header.level = start.setext_level;
                        container->as.header.setext = true;
                        offset = input.len - 1;
                        
-                   } else if (!(container->type == NODE_PARAGRAPH && !all_matched) &&
-                              (matched = scan_hrule(&input, first_nonspace))) {
+                   } else if ((start.kinds & START_HRULE) &&
+                              !(container->type == NODE_PARAGRAPH && !all_matched)) {
                        
                        // it's only now that we know the line is not part of a setext header:
                        container = add_child(parser, container, NODE_HRULE, first_nonspace + 1);
                        container = finalize(parser, container);
                        offset = input.len - 1;
                        
-                   } else if ((matched = parse_list_marker(&input, first_nonspace, &data))) {
+                   } else if (start.kinds & START_LIST) {
+                       cmark_list *data = &start.list;
+                       
+                       matched = start.list_length;
                        
                        // compute padding:
                        offset = first_nonspace + matched;
@@ -975,7 +1612,6 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
                        container = add_child(parser, container, NODE_ITEM,first_nonspace + 1);
                        /* TODO: static */
                        memcpy(&container->as.list, data, sizeof(*data));
-                       free(data);
                    } else {
                        break;
                    }
@@ -990,9 +1626,7 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
     // what remains at offset is a text line.  add the text to the
     // appropriate container.
     
-    first_nonspace = offset;
-    while (peek_at(&input, first_nonspace) == ' ')
-        first_nonspace++;
+    first_nonspace = S_find_first_nonspace(&input, &spaces, offset);
     
     indent = first_nonspace - offset;
     blank = peek_at(&input, first_nonspace) == '\n';
@@ -1025,7 +1659,7 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
         !blank &&
         parser->current->type == NODE_PARAGRAPH &&
         cmark_strbuf_len(&parser->current->string_content) > 0) {
-        add_line(parser->current, &input, offset);
+        add_line(parser, parser->current, &input, offset);
         
     } else { // not a lazy continuation
         // finalize any blocks that were not matched and set cur to container:
@@ -1034,10 +1668,16 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
             assert(parser->current != NULL);
         }
         
-        if (container->type == NODE_CODE_BLOCK ||
-            container->type == NODE_HTML) {
+        if (container->type == NODE_CODE_BLOCK &&
+            container->as.code.fenced &&
+            container->start_line == parser->line_number) {
+            
+            set_fence_info(container, &input, offset);
+            
+        } else if (container->type == NODE_CODE_BLOCK ||
+                   container->type == NODE_HTML) {
             
-            add_line(container, &input, offset);
+            add_literal_line(parser, container, &input, offset);
             
         } else if (blank) {
             // ??? do nothing
@@ -1048,12 +1688,12 @@ S_process_line(cmark_parser *parser, const unsigned char *buffer, size_t bytes)
                 container->as.header.setext == false) {
                 chop_trailing_hashtags(&input);
             }
-            add_line(container, &input, first_nonspace);
+            add_line(parser, container, &input, first_nonspace);
             
         } else {
             // create paragraph container for line
             container = add_child(parser, container, NODE_PARAGRAPH, first_nonspace + 1);
-            add_line(container, &input, first_nonspace);
+            add_line(parser, container, &input, first_nonspace);
             
         }
         parser->current = container;
@@ -1115,10 +1755,16 @@ void cmark_add_to_head(cmark_node *node,char *filename)
 // This function adds the tags to the head if they were passed in as command line parameters
 void cmark_include_files(cmark_node *document,char **argv, int *includes, int numincludes)
 {
+    cmark_parser_stats *stats = cmark_document_stats(document);
+    uint64_t start = cmark_stats_start(stats);
+    
+    cmark_trace_begin(POSTPROCESS, cmark_document_id(document), 0, stats);
     for(int i=0;i<numincludes;i++)
     {
         cmark_add_to_head(document,argv[includes[i]]);
     }
+    cmark_stats_end(stats, postprocess_ns, start);
+    cmark_trace_end(POSTPROCESS, cmark_document_id(document), 0, stats);
 }
 
 // Useful debugging function to print the nodes of a tree. I USED THIS FUNCTION A LOT WHILE DEBUGGING
@@ -1137,19 +1783,53 @@ void print_nodes(cmark_node *root)
     cmark_iter_free(iter);
 }
 
+void cmark_parser_finish_blocks(cmark_parser *parser)
+{
+    if (parser->linebuf->size) {
+        S_process_line(parser, parser->linebuf->ptr,
+                       parser->linebuf->size);
+        cmark_strbuf_clear(parser->linebuf);
+    }
+    while (parser->current != parser->root) {
+        parser->current = finalize(parser, parser->current);
+    }
+    finalize(parser, parser->root);
+}
+
 cmark_node *cmark_parser_finish(cmark_parser *parser)
 {
+    cmark_parser_stats *stats = parser->stats;
+    uint64_t start;
+    
     if (parser->linebuf->size) {
+        uint64_t finalized = stats ? stats->finalize_ns : 0;
+        
+        cmark_trace_begin(LINES, parser->root->as.document.id,
+                          parser->next_line_offset, stats);
+        start = cmark_stats_start(stats);
         S_process_line(parser, parser->linebuf->ptr,
                        parser->linebuf->size);
         cmark_strbuf_clear(parser->linebuf);
+        // blocks closed by the line were timed by finalize
+        cmark_stats_end(stats, lines_ns,
+                        start + (stats->finalize_ns - finalized));
+        cmark_trace_end(LINES, parser->root->as.document.id,
+                        parser->next_line_offset, stats);
     }
     finalize_document(parser);
-    if (parser->options & CMARK_OPT_NORMALIZE) {
+    // pending inlines are normalized as they are parsed
+    if ((parser->options & CMARK_OPT_NORMALIZE) &&
+        !(parser->options & CMARK_OPT_LAZY_INLINES)) {
+        cmark_trace_begin(POSTPROCESS, parser->root->as.document.id,
+                          parser->next_line_offset, stats);
+        start = cmark_stats_start(stats);
         cmark_consolidate_text_nodes(parser->root);
+        cmark_stats_end(stats, postprocess_ns, start);
+        cmark_trace_end(POSTPROCESS, parser->root->as.document.id,
+                        parser->next_line_offset, stats);
     }
     
-    cmark_strbuf_free(parser->curline);
+    cmark_strbuf_clear(parser->curline);
     
 #if CMARK_DEBUG_NODES
     if (cmark_node_check(parser->root, stderr)) {
@@ -8,6 +8,7 @@
 #include "config.h"
 #include "cmark_ctype.h"
 #include "buffer.h"
+#include "alloc.h"
 
 
 /* Used as default value for cmark_strbuf->ptr so that people can always
@@ -61,7 +62,7 @@ int cmark_strbuf_try_grow(cmark_strbuf *buf, int target_size, bool mark_oom)
 	/* round allocation up to multiple of 8 */
 	new_size = (new_size + 7) & ~7;
 
-	new_ptr = (unsigned char *)realloc(new_ptr, new_size);
+	new_ptr = (unsigned char *)CMARK_REALLOC(STRBUF, new_ptr, new_size);
 
 	if (!new_ptr) {
 		if (mark_oom)
@@ -100,7 +101,7 @@ void cmark_strbuf_free(cmark_strbuf *buf)
 	if (!buf) return;
 
 	if (buf->ptr != cmark_strbuf__initbuf && buf->ptr != cmark_strbuf__oom)
-		free(buf->ptr);
+		CMARK_FREE(buf->ptr);
 
 	cmark_strbuf_init(buf, 0);
 }
@@ -180,7 +181,7 @@ int cmark_strbuf_vprintf(cmark_strbuf *buf, const char *format, va_list ap)
 		va_end(args);
 
 		if (len < 0) {
-			free(buf->ptr);
+			CMARK_FREE(buf->ptr);
 			buf->ptr = cmark_strbuf__oom;
 			return -1;
 		}
@@ -239,7 +240,7 @@ unsigned char *cmark_strbuf_detach(cmark_strbuf *buf)
 
 	if (buf->asize == 0 || buf->ptr == cmark_strbuf__oom) {
 		/* return an empty string */
-		return (unsigned char *)calloc(1, 1);
+		return (unsigned char *)CMARK_CALLOC(STRBUF, 1, 1);
 	}
 
 	cmark_strbuf_init(buf, 0);
@@ -7,6 +7,7 @@
 #include <assert.h>
 #include "cmark_ctype.h"
 #include "buffer.h"
+#include "alloc.h"
 
 #define CMARK_CHUNK_EMPTY { NULL, 0, 0 }
 
@@ -19,7 +20,7 @@ typedef struct {
 static inline void cmark_chunk_free(cmark_chunk *c)
 {
 	if (c->alloc)
-		free(c->data);
+		CMARK_FREE(c->data);
 
 	c->data = NULL;
 	c->alloc = 0;
@@ -65,9 +66,12 @@ static inline const char *cmark_chunk_to_cstr(cmark_chunk *c)
 	if (c->alloc) {
 		return (char *)c->data;
 	}
-	str = (unsigned char *)malloc(c->len + 1);
+	str = (unsigned char *)CMARK_MALLOC(CHUNKS, c->len + 1);
 	if(str != NULL) {
-		memcpy(str, c->data, c->len);
+		// an empty pooled or sliced chunk may have no data at all
+		if (c->len > 0) {
+			memcpy(str, c->data, c->len);
+		}
 		str[c->len] = 0;
 	}
 	c->data  = str;
@@ -79,7 +83,7 @@ static inline const char *cmark_chunk_to_cstr(cmark_chunk *c)
 static inline void cmark_chunk_set_cstr(cmark_chunk *c, const char *str)
 {
 	if (c->alloc) {
-		free(c->data);
+		CMARK_FREE(c->data);
 	}
 	if (str == NULL) {
 		c->len   = 0;
@@ -88,7 +92,7 @@ static inline void cmark_chunk_set_cstr(cmark_chunk *c, const char *str)
 	}
 	else {
 		c->len   = strlen(str);
-		c->data  = (unsigned char *)malloc(c->len + 1);
+		c->data  = (unsigned char *)CMARK_MALLOC(CHUNKS, c->len + 1);
 		c->alloc = 1;
 		memcpy(c->data, str, c->len + 1);
 	}
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include "node.h"
+#include "parser.h"
 #include "houdini.h"
 #include "cmark.h"
 #include "buffer.h"
@@ -22,3 +23,22 @@ char *cmark_markdown_to_html(const char *text, int len, int options)
 	return result;
 }
 
+
+char *cmark_markdown_to_html_preview(const char *text, size_t len,
+                                     int options, int max_blocks,
+                                     size_t max_bytes)
+{
+	cmark_node *doc;
+	char *result;
+	int blocks;
+
+	// HTML is rarely shorter than its source, so input is read until
+	// the complete blocks would fill the preview
+	doc = cmark_parse_document_head(text, len, options, max_blocks,
+	                                max_bytes, &blocks);
+
+	result = cmark_render_html_truncated(doc, options, blocks, max_bytes);
+	cmark_node_free(doc);
+
+	return result;
+}
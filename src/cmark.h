@@ -2,6 +2,7 @@
 #define CMARK_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <cmark_export.h>
 #include <cmark_version.h>
 
@@ -26,6 +27,31 @@ extern "C" {
 CMARK_EXPORT
 char *cmark_markdown_to_html(const char *text, int len, int options);
 
+/** Convert the beginning of 'text' to HTML for a preview, limited
+ * as by `cmark_render_html_truncated`.  Only the input that the
+ * preview needs is parsed, so links to references defined later in
+ * the document are not resolved.
+ */
+CMARK_EXPORT
+char *cmark_markdown_to_html_preview(const char *text, size_t len,
+                                     int options, int max_blocks,
+                                     size_t max_bytes);
+
+/** Convert the 'n' documents 'inputs[i]' of 'lens[i]' bytes to HTML as
+ * `cmark_markdown_to_html` would, reusing one parser, with its buffers
+ * and string pool, for all of them.  The HTML of every document goes,
+ * in order, into one null-terminated buffer returned in '*out_buffer',
+ * to be freed with `cmark_free`: that of document 'i' is the bytes from
+ * 'out_offsets[i]' to 'out_offsets[i + 1]', so 'out_offsets' needs room
+ * for 'n + 1' offsets.  With 'threads' above 1 and a library built with
+ * pthreads, the documents are split among that many threads.  Returns
+ * 1, or 0 if memory ran out.
+ */
+CMARK_EXPORT
+int cmark_render_batch(const char **inputs, const size_t *lens, size_t n,
+                       int options, size_t *out_offsets, char **out_buffer,
+                       int threads);
+
 /** ## Node Structure
  */
 
@@ -89,6 +115,8 @@ typedef enum {
 typedef struct cmark_node cmark_node;
 typedef struct cmark_parser cmark_parser;
 typedef struct cmark_iter cmark_iter;
+typedef struct cmark_doc cmark_doc;
+typedef struct cmark_html_cache cmark_html_cache;
 
 typedef enum {
 	CMARK_EVENT_NONE,
@@ -262,6 +290,13 @@ CMARK_EXPORT
 const char*
 cmark_node_get_type_string(cmark_node *node);
 
+/** Returns the name of node type 'type', as used by the XML renderer
+    and 'cmark_node_get_type_string', or `"<unknown>"`.
+ */
+CMARK_EXPORT
+const char*
+cmark_node_type_string(cmark_node_type type);
+
 /** Returns the string contents of 'node', or NULL if none.
  */
 CMARK_EXPORT const char*
@@ -380,6 +415,28 @@ cmark_node_get_end_line(cmark_node *node);
 CMARK_EXPORT int
 cmark_node_get_end_column(cmark_node *node);
 
+/** Returns the byte offset in the input of the start of the first
+ * line of block 'node', or 0 for an inline node or a node not made by
+ * the parser.
+ */
+CMARK_EXPORT int
+cmark_node_get_start_offset(cmark_node *node);
+
+/** Returns the byte offset in the input just past the last line of
+ * block 'node', or 0 for an inline node or a node not made by the
+ * parser.
+ */
+CMARK_EXPORT int
+cmark_node_get_end_offset(cmark_node *node);
+
+/** Returns the text of paragraph or header 'node' as the block parser
+ * collected it, before inline parsing: without block markers and
+ * indentation, with line endings, and with inline markup as written.
+ * Returns NULL for other nodes.
+ */
+CMARK_EXPORT const char*
+cmark_node_get_content(cmark_node *node);
+
 /**
  * ## Tree Manipulation
  */
@@ -454,11 +511,190 @@ void cmark_parser_free(cmark_parser *parser);
 CMARK_EXPORT
 void cmark_parser_feed(cmark_parser *parser, const char *buffer, size_t len);
 
+/** Feeds the rest of file 'f' to 'parser'.  Regular files are mapped
+ * into memory where possible rather than read.
+ */
+CMARK_EXPORT
+void cmark_parser_feed_file(cmark_parser *parser, FILE *f);
+
 /** Finish parsing and return a pointer to a tree of nodes.
  */
 CMARK_EXPORT
 cmark_node *cmark_parser_finish(cmark_parser *parser);
 
+/** Time spent on a document in each phase of its processing, in
+ * nanoseconds of a monotonic clock, and counts of the work done.  No
+ * phase includes the time of another.
+ */
+typedef struct {
+	uint64_t lines_ns;       /**< splitting lines into blocks */
+	uint64_t finalize_ns;    /**< closing blocks, including reading
+	                              link reference definitions */
+	uint64_t inlines_ns;     /**< parsing inline content */
+	uint64_t postprocess_ns; /**< table of contents, included files
+	                              and normalization */
+	uint64_t render_ns;      /**< rendering the document */
+	uint64_t free_ns;        /**< freeing the document */
+
+	uint64_t bytes;          /**< input bytes */
+	uint64_t lines;          /**< input lines */
+	/** nodes made by the parser, indexed by type */
+	uint64_t nodes[CMARK_NODE_LAST_INLINE + 1];
+	uint64_t delimiters;     /**< emphasis, quote and link delimiters */
+	uint64_t opener_steps;   /**< delimiters passed looking for the
+	                              opener of emphasis or a quote */
+	uint64_t ref_lookups;    /**< link reference lookups */
+	uint64_t ref_hits;       /**< lookups that found a reference */
+	uint64_t ref_chain_steps;/**< references compared by lookups */
+	uint64_t buf_reallocs;   /**< reallocations of the line buffers
+	                              and of the text of blocks */
+	uint64_t peak_content;   /**< largest text of a block, in bytes */
+} cmark_parser_stats;
+
+/** Makes 'parser' add the time it spends in each phase and the work
+ * it does to 'stats', which the caller owns and should zero first.
+ * The document returned by cmark_parser_finish goes on adding to
+ * 'stats' the time spent rendering and freeing it, and the work of
+ * parsing lazy inlines, so 'stats' must outlive the document.
+ */
+CMARK_EXPORT
+void cmark_parser_set_stats(cmark_parser *parser, cmark_parser_stats *stats);
+
+/** Bounds on the work done on a document, for untrusted input.  A
+ * limit of 0 means none.  Reaching a limit does not abort: the parser
+ * keeps the rest of the input as literal text, and a renderer stops
+ * and closes the elements it left open, as cmark_render_html_truncated
+ * does.  The limits reached are recorded in 'exceeded'.
+ */
+typedef struct {
+	uint64_t max_nodes;      /**< nodes the parser makes; past it the
+	                              rest of the input is one paragraph of
+	                              text */
+	int max_depth;           /**< nesting of blocks; deeper block
+	                              starts are taken as text */
+	uint64_t max_delimiters; /**< emphasis, quote and link delimiters
+	                              in the document; past it they are
+	                              text */
+	size_t max_output;       /**< bytes of output of each render */
+	uint64_t max_ns;         /**< nanoseconds from cmark_parser_set_limits
+	                              after which parsing continues as for
+	                              max_nodes and rendering stops */
+	int exceeded;            /**< set by the library: the
+	                              CMARK_LIMIT_* of the limits reached */
+} cmark_limits;
+
+#define CMARK_LIMIT_NODES      1
+#define CMARK_LIMIT_DEPTH      2
+#define CMARK_LIMIT_DELIMITERS 4
+#define CMARK_LIMIT_OUTPUT     8
+#define CMARK_LIMIT_TIME       16
+
+/** Makes 'parser', and the renderers of the document it returns, keep
+ * to 'limits', which the caller owns and must outlive the document.
+ * Call it before feeding the parser; the time limit starts now.
+ */
+CMARK_EXPORT
+void cmark_parser_set_limits(cmark_parser *parser, cmark_limits *limits);
+
+/** Where the heap memory of the library is allocated, as counted by a
+ * library built with CMARK_ALLOC_STATS.  Memory is counted against the
+ * code that allocated it, even after it changes hands: the text of a
+ * block grows in a strbuf and stays counted as strbuf memory once it
+ * becomes the literal of a node.
+ */
+typedef enum {
+	CMARK_ALLOC_NODES,   /**< nodes */
+	CMARK_ALLOC_STRBUF,  /**< growth of string buffers, including
+	                          the output of the renderers */
+	CMARK_ALLOC_CHUNKS,  /**< copies of strings and string pools */
+	CMARK_ALLOC_REFMAP,  /**< link reference definitions */
+	CMARK_ALLOC_OTHER,   /**< the parser, delimiters, iterators,
+	                          caches and the rest */
+	CMARK_ALLOC_NUM_SOURCES
+} cmark_alloc_source;
+
+/** Counts of the allocations from one source.
+ */
+typedef struct {
+	uint64_t allocs;  /**< calls to malloc, calloc and realloc */
+	uint64_t bytes;   /**< bytes asked for by those calls */
+	uint64_t live;    /**< bytes allocated and not freed yet */
+	uint64_t peak;    /**< the largest 'live' has been */
+} cmark_alloc_counts;
+
+typedef struct {
+	cmark_alloc_counts total;  /**< peak of the sum of all sources */
+	cmark_alloc_counts sources[CMARK_ALLOC_NUM_SOURCES];
+} cmark_alloc_stats;
+
+/** Copies the allocation counts of the process into 'stats'.  Returns
+ * 1, or 0 with 'stats' zeroed if the library was built without
+ * CMARK_ALLOC_STATS.  Counting is not thread-safe: a library built
+ * with it should only be used from one thread.
+ */
+CMARK_EXPORT
+int cmark_alloc_stats_get(cmark_alloc_stats *stats);
+
+/** Zeroes the allocation counts and sets the peaks to the memory live
+ * now, so that the next cmark_alloc_stats_get covers only what happens
+ * in between.
+ */
+CMARK_EXPORT
+void cmark_alloc_stats_reset(void);
+
+/** Frees a string returned by the library, such as the output of a
+ * renderer.  This is the same as free(), except that a library built
+ * with CMARK_ALLOC_STATS stops counting the string as live at once
+ * rather than when its address is used again.
+ */
+CMARK_EXPORT
+void cmark_free(void *ptr);
+
+/** Stages of the processing of a document seen by a trace callback.
+ * They are the phases of cmark_parser_stats, except that closing
+ * blocks is part of CMARK_TRACE_LINES.
+ */
+typedef enum {
+	CMARK_TRACE_LINES,        /**< a call to cmark_parser_feed, or
+	                               the last line in cmark_parser_finish */
+	CMARK_TRACE_INLINES,      /**< parsing all inline content */
+	CMARK_TRACE_POSTPROCESS,  /**< table of contents, included files
+	                               and normalization */
+	CMARK_TRACE_RENDER,       /**< a call to a renderer */
+	CMARK_TRACE_FREE          /**< freeing a document */
+} cmark_trace_stage;
+
+typedef struct {
+	cmark_trace_stage stage;
+	int end;            /**< 0 as the stage begins, 1 as it ends */
+	uint64_t document;  /**< number of the document, counting from 1
+	                         in the order their parsers were made, or
+	                         0 for a tree made with node functions */
+	uint64_t offset;    /**< bytes of input the parser has gone
+	                         through, or 0 for rendering and freeing */
+	const cmark_parser_stats *stats;  /**< the document's stats, or
+	                                       NULL if it has none */
+} cmark_trace_event;
+
+typedef void (*cmark_trace_callback)(const cmark_trace_event *event,
+                                     void *data);
+
+/** Makes the library call 'callback' with 'data' as every stage of the
+ * processing of a document begins and ends, or stops calling it if
+ * 'callback' is NULL.  The callback is called from the thread doing
+ * the work and must not use the document; set it before other
+ * threads use the library.  A stage that rendering starts, such as
+ * parsing lazy inlines, is not reported.  Returns 1, or 0 if the
+ * library was built without CMARK_TRACE.
+ *
+ * A library built with CMARK_TRACE on a system with <sys/sdt.h> also
+ * has the static probes cmark:stage_begin and cmark:stage_end, with
+ * the stage, document, offset and stats as arguments, for perf,
+ * bpftrace and SystemTap.
+ */
+CMARK_EXPORT
+int cmark_set_trace_callback(cmark_trace_callback callback, void *data);
+
 /** Parse a CommonMark document in 'buffer' of length 'len'.
  * Returns a pointer to a tree of nodes.
  */
@@ -492,6 +728,17 @@ char *cmark_render_xml(cmark_node *root, int options);
 CMARK_EXPORT
 char *cmark_render_html(cmark_node *root, int options);
 
+/** Render the beginning of a 'node' tree as HTML: the first
+ * 'max_blocks' top-level blocks, stopping at the first node that
+ * starts after 'max_bytes' bytes of output (0 meaning no limit) and
+ * is not the first child of its parent.  A text or code literal that
+ * would not fit is cut at 'max_bytes', between UTF-8 characters, to
+ * one character at least.  The elements left open are closed.
+ */
+CMARK_EXPORT
+char *cmark_render_html_truncated(cmark_node *root, int options,
+                                  int max_blocks, size_t max_bytes);
+
 /** Render a 'node' tree as a groff man page, without the header.
  */
 CMARK_EXPORT
@@ -502,6 +749,129 @@ char *cmark_render_man(cmark_node *root, int options);
 CMARK_EXPORT
 char *cmark_render_commonmark(cmark_node *root, int options, int width);
 
+/**
+ * ## Binary Serialization
+ *
+ * A parsed tree can be saved as a compact binary image and later
+ * rendered straight from that image, without parsing or allocating
+ * nodes again.  The image contains no pointers, so it can be written
+ * to disk, memory-mapped and shared between processes.  It is only
+ * readable on machines of the same byte order.
+ *
+ *     size_t len;
+ *     unsigned char *image = cmark_serialize_binary(document, &len);
+ *     // ... later, possibly from an mmap'd file:
+ *     cmark_doc *doc = cmark_doc_map(image, len);
+ *     char *html = cmark_doc_render_html(doc, CMARK_OPT_DEFAULT);
+ *     cmark_doc_free(doc);
+ */
+
+/** Serialize the tree rooted at 'root' into a newly allocated binary
+ * image, storing its size in 'len'.  Returns NULL on failure.  The
+ * caller is responsible for freeing the image.
+ */
+CMARK_EXPORT
+unsigned char *cmark_serialize_binary(cmark_node *root, size_t *len);
+
+/** Map a binary image of 'len' bytes created by
+ * 'cmark_serialize_binary'.  The image is validated but not copied,
+ * so it must stay valid and unchanged until the returned handle is
+ * freed.  'ptr' must be aligned to 4 bytes.  Returns NULL if the
+ * image is malformed or was written with a different format version
+ * or byte order.
+ */
+CMARK_EXPORT
+cmark_doc *cmark_doc_map(const void *ptr, size_t len);
+
+/** Frees a document handle.
+ */
+CMARK_EXPORT
+void cmark_doc_free(cmark_doc *doc);
+
+/** Render a document as an HTML fragment.
+ */
+CMARK_EXPORT
+char *cmark_doc_render_html(cmark_doc *doc, int options);
+
+/** Render a document as XML.
+ */
+CMARK_EXPORT
+char *cmark_doc_render_xml(cmark_doc *doc, int options);
+
+/**
+ * ## Incremental Parsing
+ *
+ * An editable document keeps its source text and its parse tree, and
+ * brings the tree up to date after an edit by reparsing only the
+ * top-level blocks around the changed text.  Link references defined
+ * or removed by an edit are applied to the rest of the document.
+ *
+ *     cmark_doc *doc = cmark_doc_new(text, len, CMARK_OPT_DEFAULT);
+ *     cmark_doc_apply_edit(doc, 10, 3, "new", 3);
+ *     char *html = cmark_render_html(cmark_doc_get_root(doc),
+ *                                    CMARK_OPT_DEFAULT);
+ */
+
+/** Parse 'buffer' into an editable document, to be freed with
+ * cmark_doc_free.
+ */
+CMARK_EXPORT
+cmark_doc *cmark_doc_new(const char *buffer, size_t len, int options);
+
+/** Like cmark_doc_new, but the parse, each cmark_doc_apply_edit and
+ * each cmark_doc_render_* of the document keep to 'limits' as with
+ * cmark_parser_set_limits.  Each of these calls starts over: it counts
+ * only the nodes and delimiters it makes, has 'max_ns' of its own, and
+ * clears 'exceeded' first.  An edit that reaches a limit leaves the
+ * rest of the document as text.  'limits' must outlive the document.
+ */
+CMARK_EXPORT
+cmark_doc *cmark_doc_new_with_limits(const char *buffer, size_t len,
+                                     int options, cmark_limits *limits);
+
+/** Returns the root of the document's parse tree, or NULL for a mapped
+ * binary image.  The tree is owned by the document and must not be
+ * modified; it is only valid until the next edit.
+ */
+CMARK_EXPORT
+cmark_node *cmark_doc_get_root(cmark_doc *doc);
+
+/** Replace the 'old_len' bytes of source at 'offset' with the 'new_len'
+ * bytes of 'text' and update the parse tree, which then matches a
+ * parse of the whole new source.  Returns 1 on success, 0 if the range
+ * is out of bounds or the document is not editable.
+ */
+CMARK_EXPORT
+int cmark_doc_apply_edit(cmark_doc *doc, size_t offset, size_t old_len,
+                         const char *text, size_t new_len);
+
+/** Create an empty cache of rendered HTML fragments, to be used with
+ * cmark_doc_render_html_cached.
+ */
+CMARK_EXPORT
+cmark_html_cache *cmark_html_cache_new(void);
+
+/** Frees a fragment cache.
+ */
+CMARK_EXPORT
+void cmark_html_cache_free(cmark_html_cache *cache);
+
+/** Render an editable document as HTML like cmark_doc_render_html,
+ * reusing the HTML of every top-level block that no call to
+ * cmark_doc_apply_edit has reparsed or otherwise changed since the
+ * previous render with 'cache' and the same options.  Changes made to
+ * the tree through the node API are not noticed.  Fragments not used
+ * by this render are dropped from the cache.
+ */
+CMARK_EXPORT
+char *cmark_doc_render_html_cached(cmark_doc *doc, cmark_html_cache *cache,
+                                   int options);
+
+/** Returns the number of blocks the last render took from 'cache'.
+ */
+CMARK_EXPORT
+int cmark_html_cache_reused(cmark_html_cache *cache);
+
 /** Default writer options.
  */
 #define CMARK_OPT_DEFAULT 0
@@ -522,6 +892,29 @@ char *cmark_render_commonmark(cmark_node *root, int options, int width);
  */
 #define CMARK_OPT_SMART 8
 
+/** Keep a copy of the input in the document and let code blocks and
+ * HTML blocks refer to it instead of copying each of their lines.
+ * Their literals are built when first needed by a renderer or
+ * `cmark_node_get_literal`; a block whose lines are contiguous in the
+ * input is never copied.  Has no effect on `cmark_doc`.
+ */
+#define CMARK_OPT_RETAIN_INPUT 16
+
+/** Parse the inline content of a paragraph or header only when it is
+ * first needed: by `cmark_node_first_child`, `cmark_node_last_child`,
+ * an iterator that goes on to the node's children, or a renderer.
+ * The document keeps the link reference definitions until it is
+ * freed.  Has no effect on `cmark_doc`.
+ */
+#define CMARK_OPT_LAZY_INLINES 32
+
+/** Parse the block structure only.  Paragraphs and headers get no
+ * inline children; their text is left as written and can be read with
+ * `cmark_node_get_content`.  Link reference definitions are still
+ * removed from paragraphs.  Has no effect on `cmark_doc`.
+ */
+#define CMARK_OPT_BLOCKS_ONLY 64
+
 /**
  * ## Version information
  */
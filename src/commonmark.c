@@ -10,6 +10,9 @@
 #include "buffer.h"
 #include "utf8.h"
 #include "scanners.h"
+#include "stats.h"
+#include "trace.h"
+#include "governor.h"
 
 // Functions to convert cmark_nodes to commonmark strings.
 
@@ -246,7 +249,8 @@ is_autolink(cmark_node *node)
 
 	url = cmark_node_get_url(node);
 	if (url == NULL ||
-	    _scan_scheme((unsigned char *)url) == 0) {
+	    _scan_scheme((unsigned char *)url,
+	                 (unsigned char *)url + strlen(url)) == 0) {
 		return false;
 	}
 
@@ -393,7 +397,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 	case CMARK_NODE_CODE_BLOCK:
 		blankline(state);
 		info = cmark_node_get_fence_info(node);
-		code = &node->as.code.literal;
+		code = cmark_node_literal(node);
 		// use indented form if no info, and code doesn't
 		// begin or end with a blank line, and code isn't
 		// first thing in a list item
@@ -431,7 +435,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 
 	case CMARK_NODE_HTML:
 		blankline(state);
-		out(state, node->as.literal, false, LITERAL);
+		out(state, *cmark_node_literal(node), false, LITERAL);
 		blankline(state);
 		break;
 
@@ -576,6 +580,10 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 
 char *cmark_render_commonmark(cmark_node *root, int options, int width)
 {
+	cmark_parser_stats *stats = cmark_document_stats(root);
+	cmark_governor *governor = cmark_document_governor(root);
+	uint64_t inlines = stats ? stats->inlines_ns : 0;
+	uint64_t start = cmark_stats_start(stats);
 	char *result;
 	cmark_strbuf commonmark = GH_BUF_INIT;
 	cmark_strbuf prefix = GH_BUF_INIT;
@@ -586,12 +594,17 @@ char *cmark_render_commonmark(cmark_node *root, int options, int width)
 		options, &commonmark, &prefix, 0, width,
 		0, 0, true, false, false
 	};
-	cmark_node *cur;
+	cmark_node *cur = NULL;
 	cmark_event_type ev_type;
 	cmark_iter *iter = cmark_iter_new(root);
 
+	cmark_trace_begin(RENDER, cmark_document_id(root), 0, stats);
 	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
 		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != root &&
+		    cmark_governor_render_stopped(governor, commonmark.size)) {
+			break;
+		}
 		if (!S_render_node(cur, ev_type, &state)) {
 			// a false value causes us to skip processing
 			// the node's contents.  this is used for
@@ -599,9 +612,19 @@ char *cmark_render_commonmark(cmark_node *root, int options, int width)
 			cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
 		}
 	}
+	if (ev_type != CMARK_EVENT_DONE) {
+		// close the emphasis and so on around the first node left out
+		while (cur != root) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, &state);
+		}
+	}
 	result = (char *)cmark_strbuf_detach(&commonmark);
 
 	cmark_strbuf_free(&prefix);
 	cmark_iter_free(iter);
+	// inlines parsed lazily during the render were timed apart
+	cmark_stats_end(stats, render_ns, start + (stats->inlines_ns - inlines));
+	cmark_trace_end(RENDER, cmark_document_id(root), 0, stats);
 	return result;
 }
@@ -0,0 +1,659 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "config.h"
+#include "cmark.h"
+#include "node.h"
+#include "alloc.h"
+#include "buffer.h"
+#include "parser.h"
+#include "references.h"
+#include "inlines.h"
+#include "utf8.h"
+#include "iterator.h"
+#include "governor.h"
+#include "doc.h"
+
+// Documents that keep their source text and can be updated after an
+// edit by reparsing only the top-level blocks the edit touched.
+
+// The strings of the blocks and definitions that edits replace stay in
+// the document's pool.  Once the pool outgrows twice its size after the
+// last full parse by the size of the source plus this, the document is
+// parsed again into a new pool; that parse costs about as much as the
+// edits that made the garbage did.
+#define POOL_SLACK (256 * 1024)
+
+static cmark_parser *S_parser_new(int options)
+{
+	// blocks move between the trees of several parses, so they
+	// cannot refer to the input or the references of one of them;
+	// and they are always rendered with their inlines
+	cmark_parser *parser = cmark_parser_new(options &
+	                                        ~(CMARK_OPT_RETAIN_INPUT |
+	                                          CMARK_OPT_LAZY_INLINES |
+	                                          CMARK_OPT_BLOCKS_ONLY));
+
+	// keep every definition of a label, so that deleting the one in
+	// effect can reveal a later one
+	parser->refmap->keep_shadowed = true;
+	return parser;
+}
+
+// The blocks that edits reparse: the children of the root, or of the
+// body it has with includes.
+static cmark_node *S_container(cmark_doc *doc)
+{
+	cmark_node *container = doc->root;
+
+	if (container->last_child && container->last_child->type == NODE_BODY) {
+		container = container->last_child;
+	}
+	return container;
+}
+
+static uint64_t S_new_id(void)
+{
+	static uint64_t documents;
+
+#ifdef __GNUC__
+	// documents may be made in several threads
+	return __sync_add_and_fetch(&documents, 1);
+#else
+	return ++documents;
+#endif
+}
+
+// Gives the top-level block 'node' a new version, so that HTML cached
+// for it is not reused.
+static void S_touch(cmark_doc *doc, cmark_node *node)
+{
+	node->version = ++doc->versions;
+}
+
+// Marks 'node' and the blocks in it as blocks of the document, whose
+// position already includes the first 'shifts' shifts of its root.
+static void S_mark_movable(cmark_node *node, int shifts)
+{
+	cmark_iter *iter = cmark_iter_new(node);
+	cmark_event_type ev_type;
+	cmark_node *cur;
+
+	node->shifts_applied = shifts;
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type != CMARK_EVENT_ENTER) {
+			continue;
+		}
+		cur->movable = true;
+		if (cur->type == NODE_PARAGRAPH || cur->type == NODE_HEADER) {
+			cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
+		}
+	}
+	cmark_iter_free(iter);
+}
+
+static void S_parse_source(cmark_doc *doc)
+{
+	cmark_parser *parser = S_parser_new(doc->options);
+	cmark_node *node;
+
+	if (doc->limits) {
+		doc->limits->exceeded = 0;
+		// the new root owns the governor, for the later calls too
+		cmark_parser_set_limits(parser, doc->limits);
+	}
+	cmark_parser_feed(parser, (const char *)doc->source.ptr,
+	                  doc->source.size);
+	if (doc->root != NULL) {
+		cmark_node_free(doc->root);
+	}
+	cmark_reference_map_free(doc->refmap);
+	doc->root = cmark_parser_finish(parser);
+	doc->refmap = parser->refmap;
+	parser->refmap = NULL;
+	cmark_parser_free(parser);
+	doc->pool_size = doc->refmap->pool ? doc->refmap->pool->size : 0;
+	doc->finger = NULL;
+	doc->last_resync = NULL;
+	for (node = S_container(doc)->first_child; node; node = node->next) {
+		S_mark_movable(node, 0);
+		S_touch(doc, node);
+	}
+}
+
+cmark_doc *cmark_doc_new(const char *buffer, size_t len, int options)
+{
+	return cmark_doc_new_with_limits(buffer, len, options, NULL);
+}
+
+cmark_doc *cmark_doc_new_with_limits(const char *buffer, size_t len,
+                                     int options, cmark_limits *limits)
+{
+	cmark_doc *doc = (cmark_doc *)CMARK_CALLOC(OTHER, 1, sizeof(*doc));
+
+	if (doc == NULL) {
+		return NULL;
+	}
+	cmark_strbuf_init(&doc->source, 0);
+	cmark_strbuf_put(&doc->source, (const unsigned char *)buffer, len);
+	doc->options = options;
+	doc->limits = limits;
+	doc->id = S_new_id();
+	S_parse_source(doc);
+	return doc;
+}
+
+void cmark_doc_free(cmark_doc *doc)
+{
+	if (doc == NULL) {
+		return;
+	}
+	if (doc->root != NULL) {
+		cmark_node_free(doc->root);
+	}
+	cmark_reference_map_free(doc->refmap);
+	cmark_strbuf_free(&doc->source);
+	CMARK_FREE(doc);
+}
+
+cmark_node *cmark_doc_get_root(cmark_doc *doc)
+{
+	return doc ? doc->root : NULL;
+}
+
+// Returns the offset one past the end of the line starting at 'offset',
+// or INT_MAX if that line is not terminated, since any text appended
+// to it changes the line.
+static int S_line_end(cmark_strbuf *buf, int offset)
+{
+	const unsigned char *eol;
+
+	eol = (const unsigned char *)memchr(buf->ptr + offset, '\n',
+	                                    buf->size - offset);
+	return eol ? (int)(eol - buf->ptr) + 1 : INT_MAX;
+}
+
+// Returns the length of the line ending just before 'offset', as the
+// parser would have measured it.
+static int S_line_length(cmark_strbuf *buf, int offset)
+{
+	cmark_strbuf line = GH_BUF_INIT;
+	int start = offset - 1;
+	int len;
+
+	while (start > 0 && buf->ptr[start - 1] != '\n') {
+		start--;
+	}
+	utf8proc_detab(&line, buf->ptr + start, offset - start);
+	len = line.size - 1;
+	cmark_strbuf_free(&line);
+	return len;
+}
+
+// Returns whether 'node' is, or is a list or quote holding, a block of
+// type 'type'.
+static bool S_contains(cmark_node *node, cmark_node_type type)
+{
+	cmark_iter *iter;
+	cmark_event_type ev_type;
+	bool found = false;
+
+	if (node->type == type) {
+		return true;
+	}
+	if (node->type != NODE_LIST && node->type != NODE_ITEM &&
+	    node->type != NODE_BLOCK_QUOTE) {
+		return false;
+	}
+	iter = cmark_iter_new(node);
+	while (!found &&
+	       (ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		found = cmark_iter_get_node(iter)->type == type;
+	}
+	cmark_iter_free(iter);
+	return found;
+}
+
+// Where the top-level block 'node' starts, with the edits since its
+// position was last read.  The block is not moved, so that a run of
+// edits before it can still share one shift.
+static int S_start_offset(cmark_doc *doc, cmark_node *node)
+{
+	int delta;
+	int line_delta;
+
+	cmark_document_pending_shift(doc->root, node, &delta, &line_delta);
+	return node->start_offset + delta;
+}
+
+static int S_start_line(cmark_doc *doc, cmark_node *node)
+{
+	int delta;
+	int line_delta;
+
+	cmark_document_pending_shift(doc->root, node, &delta, &line_delta);
+	return node->start_line + line_delta;
+}
+
+static cmark_node *S_prev_block(cmark_node *node)
+{
+	do {
+		node = node->prev;
+	} while (node && node->type == NODE_TOC);
+	return node;
+}
+
+// Returns the last top-level block, other than a table of contents,
+// that starts at or before 'offset'.  The search starts from the first
+// or last block, or from the block of the last edit, which the next one
+// is usually close to, whichever seems closest.
+static cmark_node *S_block_at(cmark_doc *doc, cmark_node *container,
+                              int offset)
+{
+	cmark_node *node = container->first_child;
+	cmark_node *last = container->last_child;
+	cmark_node *finger = doc->finger;
+	cmark_node *found;
+
+	if (node == NULL) {
+		return NULL;
+	}
+	if (abs(offset - S_start_offset(doc, last)) <
+	    abs(offset - S_start_offset(doc, node))) {
+		node = last;
+	}
+	if (finger && finger->parent == container &&
+	    abs(offset - S_start_offset(doc, finger)) <
+	    abs(offset - S_start_offset(doc, node))) {
+		node = finger;
+	}
+	while (node && (node->type == NODE_TOC ||
+	                S_start_offset(doc, node) > offset)) {
+		node = node->prev;
+	}
+	found = node;
+	for (node = node ? node->next : container->first_child; node;
+	     node = node->next) {
+		if (node->type == NODE_TOC) {
+			continue;
+		}
+		if (S_start_offset(doc, node) > offset) {
+			break;
+		}
+		found = node;
+	}
+	return found;
+}
+
+// Returns whether an include starts in 'buf' between 'from' and 'to'.
+static bool S_has_include(cmark_strbuf *buf, int from, int to)
+{
+	int pos;
+
+	for (pos = from; pos + 1 < to && pos + 1 < buf->size; pos++) {
+		if (buf->ptr[pos] == '<' && buf->ptr[pos + 1] == '<') {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Replaces the 'old_len' bytes at 'offset' of 'buf' by the 'len' bytes
+// of 'text', moving only the bytes after them.  Returns false, leaving
+// 'buf' as it was, if it cannot grow.
+static bool S_splice(cmark_strbuf *buf, int offset, int old_len,
+                     const unsigned char *text, int len)
+{
+	cmark_strbuf copy = GH_BUF_INIT;
+	int size = buf->size - old_len + len;
+
+	if (len > 0 && text >= buf->ptr && text < buf->ptr + buf->asize) {
+		// the text is in 'buf' itself, which may move
+		cmark_strbuf_put(&copy, text, len);
+		text = copy.ptr;
+	}
+	if (cmark_strbuf_try_grow(buf, size + 1, false) < 0) {
+		cmark_strbuf_free(&copy);
+		return false;
+	}
+	memmove(buf->ptr + offset + len, buf->ptr + offset + old_len,
+	        buf->size - offset - old_len);
+	if (len > 0) {
+		memcpy(buf->ptr + offset, text, len);
+	}
+	buf->size = size;
+	buf->ptr[size] = '\0';
+	cmark_strbuf_free(&copy);
+	return true;
+}
+
+// Records that the blocks from 'resync' on moved.  A run of edits before
+// the same block shares one shift until a block it moved is read, so
+// that typing at one place keeps a single shift.
+static void S_add_shift(cmark_doc *doc, cmark_node *container,
+                        cmark_node *resync, int offset, int delta,
+                        int line_delta)
+{
+	cmark_document *root = &doc->root->as.document;
+	cmark_shift *shift = root->shifts_size > 0 ?
+	                     &root->shifts[root->shifts_size - 1] : NULL;
+	cmark_node *node;
+
+	if (delta == 0 && line_delta == 0) {
+		doc->last_resync = NULL;
+		return;
+	}
+	if (shift && resync == doc->last_resync && !shift->taken &&
+	    shift->offset + shift->delta == offset) {
+		shift->delta += delta;
+		shift->line_delta += line_delta;
+		return;
+	}
+	if (root->shifts_size == CMARK_MAX_SHIFTS) {
+		for (node = container->first_child; node; node = node->next) {
+			cmark_node_ensure_position(node);
+			node->shifts_applied = 0;
+		}
+		root->shifts_size = 0;
+	}
+	shift = &root->shifts[root->shifts_size++];
+	shift->offset = offset;
+	shift->delta = delta;
+	shift->line_delta = line_delta;
+	shift->taken = false;
+	doc->last_resync = resync;
+}
+
+// Blocks closed on the line they start, such as rules, end at the
+// previous line, whose length may have changed.  Returns whether any
+// column changed.
+static bool S_fix_end_columns(cmark_node *node, int column)
+{
+	cmark_iter *iter = cmark_iter_new(node);
+	cmark_event_type ev_type;
+	cmark_node *cur;
+	int line = node->start_line - 1;
+	bool changed = false;
+
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur->end_line == line &&
+		    cur->start_line != 0 && cur->end_column != column) {
+			cur->end_column = column;
+			changed = true;
+		}
+	}
+	cmark_iter_free(iter);
+	return changed;
+}
+
+// Parses the inline content of paragraphs and headers below 'node'.
+// With 'reparse' set, only blocks that may contain a link reference
+// are handled, after dropping the inlines parsed before.  Returns
+// whether any block was handled.
+static bool S_parse_inlines(cmark_node *node, cmark_reference_map *refmap,
+                            int options, bool reparse)
+{
+	cmark_iter *iter = cmark_iter_new(node);
+	cmark_event_type ev_type;
+	cmark_node *cur;
+	bool parsed = false;
+
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type != CMARK_EVENT_ENTER ||
+		    (cur->type != NODE_PARAGRAPH && cur->type != NODE_HEADER)) {
+			continue;
+		}
+		if (reparse) {
+			if (cur->string_content.size == 0 ||
+			    memchr(cur->string_content.ptr, '[',
+			           cur->string_content.size) == NULL) {
+				continue;
+			}
+			while (cur->first_child) {
+				cmark_node_free(cur->first_child);
+			}
+		}
+		cmark_parse_inlines(cur, refmap, options);
+		if (options & CMARK_OPT_NORMALIZE) {
+			cmark_consolidate_text_nodes(cur);
+		}
+		parsed = true;
+		// the iterator must not descend into the new inlines
+		cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
+	}
+	cmark_iter_free(iter);
+	return parsed;
+}
+
+int cmark_doc_apply_edit(cmark_doc *doc, size_t offset, size_t old_len,
+                         const char *text, size_t new_len)
+{
+	cmark_parser *parser;
+	cmark_governor *governor;
+	cmark_node *container;
+	cmark_node *first;
+	cmark_node *resync = NULL;
+	cmark_node *candidate;
+	cmark_node *node;
+	cmark_node *next;
+	cmark_reference *removed;
+	cmark_reference *added;
+	const unsigned char *eol;
+	int start, old_end, new_end, delta, region, region_end;
+	int pos, len, line_delta;
+	int line = 0;
+	int line_length = 0;
+	bool full = false;
+	bool refs_changed;
+	bool headers_changed = false;
+
+	if (doc == NULL || doc->root == NULL ||
+	    offset > (size_t)doc->source.size ||
+	    old_len > doc->source.size - offset ||
+	    new_len > (size_t)(INT_MAX - doc->source.size)) {
+		return 0;
+	}
+	if (doc->root->as.document.shifts == NULL) {
+		doc->root->as.document.shifts = (cmark_shift *)
+		    CMARK_CALLOC(OTHER, CMARK_MAX_SHIFTS, sizeof(cmark_shift));
+		if (doc->root->as.document.shifts == NULL) {
+			return 0;
+		}
+	}
+	start = (int)offset;
+	old_end = start + (int)old_len;
+	new_end = start + (int)new_len;
+	delta = (int)new_len - (int)old_len;
+	container = S_container(doc);
+
+	// Reparse from the last top-level block whose first line is left
+	// intact, so that the edited text is seen in the same context.
+	first = S_block_at(doc, container, start);
+	if (first &&
+	    start < S_line_end(&doc->source, S_start_offset(doc, first))) {
+		first = S_prev_block(first);
+	}
+	region = first ? S_start_offset(doc, first) : 0;
+	if (region > 0) {
+		line = S_start_line(doc, first) - 1;
+		line_length = S_line_length(&doc->source, region);
+	}
+	if (first == NULL) {
+		first = container->first_child;
+	}
+	// the text the edit replaces may hold an include
+	if (container != doc->root) {
+		full = S_has_include(&doc->source, region, old_end + 1);
+	}
+	if (!S_splice(&doc->source, start, (int)old_len,
+	              (const unsigned char *)text, (int)new_len)) {
+		return 0;
+	}
+
+	// the edit keeps to the limits of the document, in the governor of
+	// its root, which the inlines of the new blocks are parsed with too
+	governor = cmark_document_governor(doc->root);
+	cmark_governor_restart(governor);
+	parser = S_parser_new(doc->options);
+	if (governor) {
+		parser->governor = governor;
+		parser->refmap->governor = governor;
+	}
+	// the new definitions go straight into the document's pool
+	parser->refmap->pool = doc->refmap->pool;
+	parser->next_line_offset = region;
+	if (region > 0) {
+		parser->line_number = line;
+		parser->last_line_length = line_length;
+	}
+
+	// Feed line by line until a top-level block starts, past the edit,
+	// at a line where an old block started too; the rest of the tree
+	// is unaffected from there on.
+	candidate = first;
+	pos = region;
+	while (pos < doc->source.size) {
+		eol = (const unsigned char *)memchr(doc->source.ptr + pos, '\n',
+		                                    doc->source.size - pos);
+		len = eol ? (int)(eol - (doc->source.ptr + pos)) + 1 :
+		      doc->source.size - pos;
+		cmark_parser_feed(parser, (const char *)doc->source.ptr + pos, len);
+
+		node = parser->root->last_child;
+		if (pos > region && pos >= new_end && node &&
+		    node->start_offset == pos && eol) {
+			while (candidate &&
+			       (candidate->type == NODE_TOC ||
+			        S_start_offset(doc, candidate) < pos - delta)) {
+				candidate = candidate->next;
+			}
+			if (candidate && S_start_offset(doc, candidate) == pos - delta) {
+				resync = candidate;
+				cmark_node_free(node);
+				break;
+			}
+		}
+		pos += len;
+	}
+	if (resync == NULL) {
+		cmark_parser_finish_blocks(parser);
+	}
+	region_end = resync ? S_start_offset(doc, resync) : INT_MAX;
+
+	// Includes and tables of contents affect the whole document.
+	if (parser->root->first_child &&
+	    parser->root->first_child->type == NODE_HEAD) {
+		full = true;
+	}
+	for (node = parser->root->first_child; !full && node; node = node->next) {
+		full = S_contains(node, NODE_TOC);
+	}
+	for (node = first; !full && node != resync; node = node->next) {
+		full = S_contains(node, NODE_TOC);
+	}
+	if (!full && container != doc->root) {
+		full = S_has_include(&doc->source, new_end,
+		                     resync ? region_end + delta :
+		                     doc->source.size);
+	}
+	if (full) {
+		cmark_node_free(parser->root);
+		cmark_parser_free(parser);
+		S_parse_source(doc);
+		return 1;
+	}
+
+	// Swap the definitions made by the old blocks for the new ones.
+	removed = cmark_reference_map_take(doc->refmap, region, region_end);
+	if (resync) {
+		cmark_reference_map_shift(doc->refmap, region_end, delta);
+	}
+	added = cmark_reference_map_take(parser->refmap, INT_MIN, INT_MAX);
+	refs_changed = !cmark_reference_list_equal(removed, added);
+	cmark_reference_list_free(removed);
+	cmark_reference_map_insert(doc->refmap, added);
+
+	for (node = first; node != resync; node = next) {
+		next = node->next;
+		headers_changed = headers_changed || S_contains(node, NODE_HEADER);
+		cmark_node_free(node);
+	}
+
+	// The blocks after the edit are moved when their position is read;
+	// their positions and those of the blocks in them are still the old
+	// ones until then.
+	if (resync) {
+		if (S_fix_end_columns(resync, S_line_length(&doc->source,
+		                                            region_end + delta))) {
+			S_touch(doc, resync);
+		}
+		line_delta = parser->line_number - S_start_line(doc, resync);
+		S_add_shift(doc, container, resync, region_end, delta, line_delta);
+		for (node = container; node; node = node->parent) {
+			node->end_line += line_delta;
+			node->end_offset += delta;
+		}
+	} else {
+		doc->last_resync = NULL;
+		for (node = container; node; node = node->parent) {
+			node->end_line = parser->root->end_line;
+			node->end_column = parser->root->end_column;
+			node->end_offset = parser->root->end_offset;
+		}
+	}
+
+	first = parser->root->first_child;
+	while ((node = parser->root->first_child) != NULL) {
+		cmark_node_unlink(node);
+		S_mark_movable(node, doc->root->as.document.shifts_size);
+		S_touch(doc, node);
+		headers_changed = headers_changed || S_contains(node, NODE_HEADER);
+		if (resync) {
+			cmark_node_insert_before(resync, node);
+		} else {
+			cmark_node_append_child(container, node);
+		}
+	}
+	doc->finger = first ? first : resync;
+	cmark_node_free(parser->root);
+	cmark_parser_free(parser);
+
+	for (node = first; node && node != resync; node = node->next) {
+		S_parse_inlines(node, doc->refmap, doc->options, false);
+	}
+	if (refs_changed) {
+		// links elsewhere may now resolve differently
+		for (node = container->first_child; node; node = node->next) {
+			if (node == first) {
+				node = resync;
+				if (node == NULL) {
+					break;
+				}
+			}
+			if (S_parse_inlines(node, doc->refmap, doc->options, true)) {
+				S_touch(doc, node);
+			}
+		}
+	}
+	if (headers_changed) {
+		// a table of contents lists the headers, and numbers their
+		// ids; those before the edit keep theirs
+		update_toc(doc->root);
+		for (node = resync; node; node = node->next) {
+			if (S_contains(node, NODE_HEADER)) {
+				S_touch(doc, node);
+			}
+		}
+	}
+
+	if (doc->refmap->pool &&
+	    doc->refmap->pool->size > 2 * doc->pool_size +
+	                              (size_t)doc->source.size + POOL_SLACK) {
+		S_parse_source(doc);
+	}
+	return 1;
+}
@@ -0,0 +1,93 @@
+#ifndef CMARK_DOC_H
+#define CMARK_DOC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cmark.h"
+#include "buffer.h"
+
+#define CMARK_BINARY_MAGIC "CMKB"
+#define CMARK_BINARY_VERSION 1
+#define CMARK_BINARY_BYTE_ORDER 0x01020304u
+#define CMARK_BINARY_NO_STRING 0xffffffffu
+
+/* String slots of a serialized node. */
+enum {
+	CMARK_BINARY_STR_LITERAL, /* literal, code literal or link url */
+	CMARK_BINARY_STR_EXTRA,   /* code info or link title */
+	CMARK_BINARY_STR_USER,    /* header id or TOC item level */
+	CMARK_BINARY_NUM_STRINGS
+};
+
+/* All fields are stored in host byte order; 'byte_order' lets a reader
+ * reject an image produced on a machine of the other endianness. */
+typedef struct {
+	char     magic[4];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t node_count;
+	uint32_t max_depth;
+	uint32_t pool_offset;
+	uint32_t pool_size;
+	uint32_t reserved;
+} cmark_binary_header;
+
+/* Nodes are stored in document order.  'end' is the index one past
+ * the node's last descendant, so the children of node i are the
+ * records i+1 .. end-1 and its next sibling (if any) is record 'end'.
+ * Strings are (offset, length) pairs into the NUL-terminated string
+ * pool that follows the node table. */
+typedef struct {
+	uint32_t type;
+	uint32_t end;
+	int32_t  start_line;
+	int32_t  start_column;
+	int32_t  end_line;
+	int32_t  end_column;
+	uint32_t str[CMARK_BINARY_NUM_STRINGS][2];
+	int32_t  ints[4];
+} cmark_binary_node;
+
+struct cmark_doc {
+	/* Mapped binary image; owned by the caller. */
+	const unsigned char *image;
+	const cmark_binary_header *header;
+	const cmark_binary_node *nodes;
+	const unsigned char *pool;
+
+	/* Editable document, see doc.c. */
+	cmark_node *root;
+	struct cmark_reference_map *refmap;
+	cmark_strbuf source;
+	int options;
+	cmark_limits *limits;       /* not owned; may be NULL */
+	size_t pool_size;           /* of the string pool after a full parse */
+	uint64_t id;                /* unique among the documents made */
+	unsigned int versions;      /* the last version given to a block */
+	/* A top-level block near the last edit, where the next one starts
+	 * looking for its blocks, and the block that edit resynchronized
+	 * at; both NULL after a full parse. */
+	cmark_node *finger;
+	cmark_node *last_resync;
+};
+
+typedef int (*cmark_doc_walk_fn)(cmark_node *node, cmark_event_type ev_type,
+                                 void *data);
+
+/* Calls 'fn' for every ENTER and EXIT event of the document, in the
+ * same order as a cmark_iter would, passing transient nodes that are
+ * only valid for the duration of the call.  If 'fn' returns 0 on
+ * entering a node, its children are skipped.  Returns 0 on allocation
+ * failure, 1 otherwise. */
+int cmark_doc_walk(cmark_doc *doc, cmark_doc_walk_fn fn, void *data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
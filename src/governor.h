@@ -0,0 +1,103 @@
+#ifndef CMARK_GOVERNOR_H
+#define CMARK_GOVERNOR_H
+
+#include <stdint.h>
+
+#include "config.h"
+#include "cmark.h"
+#include "stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// How a document keeps to the cmark_limits of its parser.  The document
+// owns it; the parser and the reference map (and through it the inline
+// parser) point to it.
+typedef struct cmark_governor {
+	cmark_limits *limits;  // not owned
+	uint64_t nodes;
+	uint64_t delimiters;
+	uint64_t deadline;     // of cmark_stats_clock, or 0
+	unsigned ticks;
+} cmark_governor;
+
+// The clock is only read every this many checks.
+#define GOVERNOR_CLOCK_TICKS 64
+
+static inline bool cmark_governor_time_up(cmark_governor *g)
+{
+	if (g->limits->exceeded & CMARK_LIMIT_TIME) {
+		return true;
+	}
+	if (g->deadline && ++g->ticks % GOVERNOR_CLOCK_TICKS == 0 &&
+	    cmark_stats_clock() >= g->deadline) {
+		g->limits->exceeded |= CMARK_LIMIT_TIME;
+		return true;
+	}
+	return false;
+}
+
+// Starts the limits over for another call on an editable document:
+// nothing counted or exceeded yet, and the time limit from now.
+static inline void cmark_governor_restart(cmark_governor *g)
+{
+	if (g == NULL) {
+		return;
+	}
+	g->limits->exceeded = 0;
+	g->nodes = 0;
+	g->delimiters = 0;
+	g->deadline = g->limits->max_ns ?
+	              cmark_stats_clock() + g->limits->max_ns : 0;
+}
+
+// Returns true once the parser must take the rest of the input as text.
+static inline bool cmark_governor_parse_stopped(cmark_governor *g)
+{
+	return g && ((g->limits->exceeded & CMARK_LIMIT_NODES) ||
+	             cmark_governor_time_up(g));
+}
+
+static inline void cmark_governor_count_node(cmark_governor *g)
+{
+	if (g && g->limits->max_nodes &&
+	    ++g->nodes >= g->limits->max_nodes) {
+		g->limits->exceeded |= CMARK_LIMIT_NODES;
+	}
+}
+
+// Returns true, counting it, if a delimiter may be pushed.
+static inline bool cmark_governor_add_delimiter(cmark_governor *g)
+{
+	if (g == NULL) {
+		return true;
+	}
+	if (g->limits->max_delimiters &&
+	    g->delimiters >= g->limits->max_delimiters) {
+		g->limits->exceeded |= CMARK_LIMIT_DELIMITERS;
+		return false;
+	}
+	g->delimiters++;
+	return true;
+}
+
+// Returns true if a render that has written 'size' bytes must stop.
+static inline bool cmark_governor_render_stopped(cmark_governor *g,
+                                                 size_t size)
+{
+	if (g == NULL) {
+		return false;
+	}
+	if (g->limits->max_output && size >= g->limits->max_output) {
+		g->limits->exceeded |= CMARK_LIMIT_OUTPUT;
+		return true;
+	}
+	return cmark_governor_time_up(g);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
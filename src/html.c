@@ -6,8 +6,14 @@
 #include "config.h"
 #include "cmark.h"
 #include "node.h"
+#include "alloc.h"
 #include "buffer.h"
 #include "houdini.h"
+#include "html.h"
+#include "doc.h"
+#include "stats.h"
+#include "trace.h"
+#include "governor.h"
 
 // Functions to convert cmark_nodes to HTML strings.
 
@@ -49,12 +55,10 @@ static void
 S_render_sourcepos(cmark_node *node, cmark_strbuf *html, int options)
 {
 	if (CMARK_OPT_SOURCEPOS & options) {
-        printf("Options matched\n");
+		cmark_node_ensure_position(node);
 		cmark_strbuf_printf(html, " data-sourcepos=\"%d:%d-%d:%d\"",
-		                    cmark_node_get_start_line(node),
-		                    cmark_node_get_start_column(node),
-		                    cmark_node_get_end_line(node),
-		                    cmark_node_get_end_column(node));
+		                    node->start_line, node->start_column,
+		                    node->end_line, node->end_column);
 	}
 }
 
@@ -76,6 +80,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 	char start_header[] = "<h0";
 	char end_header[] = "</h0";
 	bool tight;
+	cmark_chunk *literal;
 
 	bool entering = (ev_type == CMARK_EVENT_ENTER);
 
@@ -293,14 +298,15 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 			cmark_strbuf_puts(html, "\">");
 		}
 
-		escape_html(html, node->as.code.literal.data,
-		            node->as.code.literal.len);
+		literal = cmark_node_literal(node);
+		escape_html(html, literal->data, literal->len);
 		cmark_strbuf_puts(html, "</code></pre>\n");
 		break;
 
 	case CMARK_NODE_HTML:
 		cr(html);
-		cmark_strbuf_put(html, node->as.literal.data, node->as.literal.len);
+		literal = cmark_node_literal(node);
+		cmark_strbuf_put(html, literal->data, literal->len);
 		break;
 
 	case CMARK_NODE_HRULE:
@@ -479,21 +485,485 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 	return 1;
 }
 
-char *cmark_render_html(cmark_node *root, int options)
+// Top-level blocks are the children of the root and of its body.
+static bool S_is_top_level(cmark_node *root, cmark_node *node)
 {
-	char *result;
-	cmark_strbuf html = GH_BUF_INIT;
+	cmark_node *parent = node->parent;
+
+	return node != root && parent != NULL &&
+	       (parent == root ||
+	        (parent->type == CMARK_NODE_BODY && parent->parent == root)) &&
+	       node->type != CMARK_NODE_HEAD &&
+	       node->type != CMARK_NODE_BODY;
+}
+
+// Returns how many bytes of 'literal' escape to at most 'room' bytes of
+// HTML, at the start of a UTF-8 sequence, but at least one character
+// if 'nonempty' is set.
+static int S_fit_literal(const cmark_chunk *literal, size_t room,
+                         bool nonempty)
+{
+	size_t size = 0;
+	int len = 0;
+	unsigned char c;
+
+	while (len < literal->len) {
+		c = literal->data[len];
+		size += c == '"' ? 6 : c == '&' ? 5 : c == '<' || c == '>' ? 4 : 1;
+		if (size > room) {
+			break;
+		}
+		len++;
+	}
+	if (len == 0 && nonempty && literal->len > 0) {
+		len = 1;
+		while (len < literal->len && (literal->data[len] & 0xC0) == 0x80) {
+			len++;
+		}
+	}
+	while (len > 0 && len < literal->len &&
+	       (literal->data[len] & 0xC0) == 0x80) {
+		len--;
+	}
+	return len;
+}
+
+// Renders 'root' at the end of 'html', stopping as
+// cmark_render_html_truncated does and when the document's governor
+// says so.
+static void S_render_html(cmark_strbuf *html, cmark_node *root, int options,
+                          int max_blocks, size_t max_bytes)
+{
+	cmark_parser_stats *stats = cmark_document_stats(root);
+	cmark_governor *governor = cmark_document_governor(root);
+	uint64_t inlines = stats ? stats->inlines_ns : 0;
+	uint64_t start = cmark_stats_start(stats);
+	int begin = html->size;
 	cmark_event_type ev_type;
-	cmark_node *cur;
-	struct render_state state = { &html, NULL, false,1,0,true};
+	cmark_node *cur = NULL;
+	cmark_node cut;
+	cmark_chunk *literal;
+	struct render_state state = { html, NULL, false,1,0,true};
 	cmark_iter *iter = cmark_iter_new(root);
+	size_t room;
+	int blocks = 0;
+	int len;
 
+	cmark_trace_begin(RENDER, cmark_document_id(root), 0, stats);
 	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
 		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != root) {
+			if (cmark_governor_render_stopped(governor,
+			                                  html->size - begin)) {
+				break;
+			}
+			// an element is not left empty
+			if (max_bytes > 0 &&
+			    (size_t)(html->size - begin) >= max_bytes &&
+			    cur->prev != NULL) {
+				break;
+			}
+			if (S_is_top_level(root, cur)) {
+				if (max_blocks > 0 && blocks == max_blocks) {
+					break;
+				}
+				blocks++;
+			}
+			// a text or code literal that would not fit is cut
+			if (max_bytes > 0 && (cur->type == CMARK_NODE_TEXT ||
+			                      cur->type == CMARK_NODE_CODE ||
+			                      cur->type == CMARK_NODE_CODE_BLOCK)) {
+				literal = cmark_node_literal(cur);
+				room = (size_t)(html->size - begin) < max_bytes ?
+				       max_bytes - (size_t)(html->size - begin) : 0;
+				len = S_fit_literal(literal, room, cur->prev == NULL);
+				if (len < literal->len) {
+					cut = *cur;
+					cmark_node_literal(&cut)->len = len;
+					S_render_node(&cut, ev_type, &state, options);
+					break;
+				}
+			}
+		}
 		S_render_node(cur, ev_type, &state, options);
 	}
-	result = (char *)cmark_strbuf_detach(&html);
+	if (ev_type != CMARK_EVENT_DONE) {
+		// close the elements around the first node left out
+		while (cur != root) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, &state, options);
+		}
+	}
+
+	cmark_iter_free(iter);
+	// inlines parsed lazily during the render were timed apart
+	cmark_stats_end(stats, render_ns, start + (stats->inlines_ns - inlines));
+	cmark_trace_end(RENDER, cmark_document_id(root), 0, stats);
+}
+
+void cmark_render_html_append(cmark_strbuf *html, cmark_node *root,
+                              int options)
+{
+	S_render_html(html, root, options, 0, 0);
+}
+
+char *cmark_render_html(cmark_node *root, int options)
+{
+	cmark_strbuf html = GH_BUF_INIT;
+
+	S_render_html(&html, root, options, 0, 0);
+	return (char *)cmark_strbuf_detach(&html);
+}
+
+char *cmark_render_html_truncated(cmark_node *root, int options,
+                                  int max_blocks, size_t max_bytes)
+{
+	cmark_strbuf html = GH_BUF_INIT;
+
+	S_render_html(&html, root, options, max_blocks, max_bytes);
+	return (char *)cmark_strbuf_detach(&html);
+}
+
+struct doc_render_state {
+	struct render_state *state;
+	int options;
+};
+
+static int
+S_render_doc_node(cmark_node *node, cmark_event_type ev_type, void *data)
+{
+	struct doc_render_state *doc_state = (struct doc_render_state *)data;
+
+	return S_render_node(node, ev_type, doc_state->state,
+	                     doc_state->options);
+}
+
+char *cmark_doc_render_html(cmark_doc *doc, int options)
+{
+	cmark_strbuf html = GH_BUF_INIT;
+	struct render_state state = { &html, NULL, false,1,0,true};
+	struct doc_render_state doc_state = { &state, options };
+
+	if (doc != NULL && doc->root != NULL) {
+		cmark_governor_restart(cmark_document_governor(doc->root));
+		S_render_html(&html, doc->root, options, 0, 0);
+		return (char *)cmark_strbuf_detach(&html);
+	}
+	if (doc == NULL || !cmark_doc_walk(doc, S_render_doc_node, &doc_state)) {
+		cmark_strbuf_free(&html);
+		return NULL;
+	}
+	return (char *)cmark_strbuf_detach(&html);
+}
+
+// Cache of the HTML of top-level blocks, keyed by the block and its
+// version, which cmark_doc_apply_edit() changes whenever the HTML of
+// the block may have changed, and by what else the HTML depends on.
+
+#define CACHE_INITIAL_SIZE 64
+
+typedef struct html_fragment {
+	struct html_fragment *next;
+	cmark_node *block;
+	unsigned int version;
+	int options;
+	int prev;
+	int start_line;           // with CMARK_OPT_SOURCEPOS, else 0
+	unsigned int generation;
+	int len;
+	unsigned char *data;
+} html_fragment;
+
+struct cmark_html_cache {
+	html_fragment **buckets;
+	unsigned int size;        // number of buckets, a power of two
+	unsigned int count;
+	unsigned int generation;  // incremented by each render
+	uint64_t doc_id;          // of the document the fragments are of
+	int reused;
+};
+
+cmark_html_cache *cmark_html_cache_new(void)
+{
+	cmark_html_cache *cache =
+	    (cmark_html_cache *)CMARK_CALLOC(OTHER, 1, sizeof(*cache));
+
+	if (cache == NULL) {
+		return NULL;
+	}
+	cache->buckets = (html_fragment **)CMARK_CALLOC(OTHER, CACHE_INITIAL_SIZE,
+	                                                sizeof(*cache->buckets));
+	if (cache->buckets == NULL) {
+		CMARK_FREE(cache);
+		return NULL;
+	}
+	cache->size = CACHE_INITIAL_SIZE;
+	return cache;
+}
+
+void cmark_html_cache_free(cmark_html_cache *cache)
+{
+	html_fragment *frag;
+	html_fragment *next;
+	unsigned int i;
+
+	if (cache == NULL) {
+		return;
+	}
+	for (i = 0; i < cache->size; i++) {
+		for (frag = cache->buckets[i]; frag; frag = next) {
+			next = frag->next;
+			CMARK_FREE(frag->data);
+			CMARK_FREE(frag);
+		}
+	}
+	CMARK_FREE(cache->buckets);
+	CMARK_FREE(cache);
+}
+
+int cmark_html_cache_reused(cmark_html_cache *cache)
+{
+	return cache ? cache->reused : 0;
+}
+
+static unsigned int S_bucket(cmark_html_cache *cache, cmark_node *block)
+{
+	uintptr_t key = (uintptr_t)block;
+
+	// nodes are at least 8-byte aligned
+	key = (key >> 3) ^ (key >> 15);
+	return (unsigned int)key & (cache->size - 1);
+}
+
+static void S_grow_cache(cmark_html_cache *cache)
+{
+	html_fragment **buckets;
+	html_fragment **old = cache->buckets;
+	html_fragment *frag;
+	html_fragment *next;
+	unsigned int old_size = cache->size;
+	unsigned int i;
+
+	buckets = (html_fragment **)CMARK_CALLOC(OTHER, old_size * 2,
+	                                         sizeof(*buckets));
+	if (buckets == NULL) {
+		return;
+	}
+	cache->buckets = buckets;
+	cache->size = old_size * 2;
+	for (i = 0; i < old_size; i++) {
+		for (frag = old[i]; frag; frag = next) {
+			next = frag->next;
+			frag->next = buckets[S_bucket(cache, frag->block)];
+			buckets[S_bucket(cache, frag->block)] = frag;
+		}
+	}
+	CMARK_FREE(old);
+}
 
+// 'prev' tells whether the output so far is empty (0), ends in a
+// newline (1) or not (2), which decides what cr() emits first.
+static html_fragment *S_find_fragment(cmark_html_cache *cache,
+                                      cmark_node *block, int options,
+                                      int prev, int start_line)
+{
+	html_fragment *frag;
+
+	for (frag = cache->buckets[S_bucket(cache, block)]; frag;
+	     frag = frag->next) {
+		if (frag->block == block && frag->version == block->version &&
+		    frag->options == options && frag->prev == prev &&
+		    frag->start_line == start_line) {
+			return frag;
+		}
+	}
+	return NULL;
+}
+
+// Takes 'data'.
+static void S_add_fragment(cmark_html_cache *cache, cmark_node *block,
+                           int options, int prev, int start_line,
+                           unsigned char *data, int len)
+{
+	html_fragment *frag = (html_fragment *)CMARK_MALLOC(OTHER, sizeof(*frag));
+	html_fragment **bucket;
+
+	if (frag == NULL) {
+		CMARK_FREE(data);
+		return;
+	}
+	if (cache->count >= cache->size) {
+		S_grow_cache(cache);
+	}
+	bucket = &cache->buckets[S_bucket(cache, block)];
+	frag->block = block;
+	frag->version = block->version;
+	frag->options = options;
+	frag->prev = prev;
+	frag->start_line = start_line;
+	frag->generation = cache->generation;
+	frag->len = len;
+	frag->data = data;
+	frag->next = *bucket;
+	*bucket = frag;
+	cache->count++;
+}
+
+// Drops the fragments the last render did not use.
+static void S_sweep_cache(cmark_html_cache *cache)
+{
+	html_fragment **link;
+	html_fragment *frag;
+	unsigned int i;
+
+	for (i = 0; i < cache->size; i++) {
+		link = &cache->buckets[i];
+		while ((frag = *link) != NULL) {
+			if (frag->generation != cache->generation) {
+				*link = frag->next;
+				CMARK_FREE(frag->data);
+				CMARK_FREE(frag);
+				cache->count--;
+			} else {
+				link = &frag->next;
+			}
+		}
+	}
+}
+
+// Returns false if 'governor' stopped the render within the block, after
+// closing the elements it left open; what was rendered is not cached.
+static bool
+S_render_block_cached(cmark_html_cache *cache, cmark_node *block,
+                      struct render_state *state, cmark_governor *governor,
+                      int options)
+{
+	cmark_strbuf *html = state->html;
+	cmark_strbuf fragment = GH_BUF_INIT;
+	cmark_event_type ev_type;
+	cmark_node *cur = NULL;
+	cmark_iter *iter;
+	html_fragment *frag;
+	int prev = 0;
+	int start_line = 0;
+	int len;
+
+	if (html->size > 0) {
+		prev = html->ptr[html->size - 1] == '\n' ? 1 : 2;
+	}
+	if (options & CMARK_OPT_SOURCEPOS) {
+		// edits before the block move it without changing its version
+		start_line = cmark_node_get_start_line(block);
+	}
+	frag = S_find_fragment(cache, block, options, prev, start_line);
+	if (frag != NULL &&
+	    (governor == NULL || governor->limits->max_output == 0 ||
+	     (size_t)(html->size + frag->len) < governor->limits->max_output)) {
+		frag->generation = cache->generation;
+		cmark_strbuf_put(html, frag->data, frag->len);
+		cache->reused++;
+		return true;
+	}
+
+	// stand in for the last byte of the output so far
+	if (prev > 0) {
+		cmark_strbuf_putc(&fragment, html->ptr[html->size - 1]);
+	}
+	state->html = &fragment;
+	iter = cmark_iter_new(block);
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER &&
+		    cmark_governor_render_stopped(governor, html->size +
+		                                  fragment.size - (prev > 0))) {
+			break;
+		}
+		S_render_node(cur, ev_type, state, options);
+	}
+	if (ev_type != CMARK_EVENT_DONE) {
+		while (cur != block) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, state, options);
+		}
+	}
+	cmark_iter_free(iter);
+	state->html = html;
+
+	len = fragment.size - (prev > 0);
+	cmark_strbuf_put(html, fragment.ptr + (prev > 0), len);
+	if (ev_type != CMARK_EVENT_DONE) {
+		cmark_strbuf_free(&fragment);
+		return false;
+	}
+	if (prev > 0) {
+		cmark_strbuf_drop(&fragment, 1);
+	}
+	S_add_fragment(cache, block, options, prev, start_line,
+	               cmark_strbuf_detach(&fragment), len);
+	return true;
+}
+
+static bool S_is_cacheable(cmark_doc *doc, cmark_node *node)
+{
+	cmark_node *parent = node->parent;
+
+	return parent != NULL &&
+	       (parent == doc->root || parent->type == CMARK_NODE_BODY) &&
+	       node->type != CMARK_NODE_HEAD &&
+	       node->type != CMARK_NODE_BODY &&
+	       node->type != CMARK_NODE_TOC;
+}
+
+char *cmark_doc_render_html_cached(cmark_doc *doc, cmark_html_cache *cache,
+                                   int options)
+{
+	cmark_strbuf html = GH_BUF_INIT;
+	struct render_state state = { &html, NULL, false,1,0,true};
+	cmark_governor *governor;
+	cmark_event_type ev_type;
+	cmark_node *cur = NULL;
+	cmark_iter *iter;
+
+	if (doc == NULL || doc->root == NULL || cache == NULL) {
+		return cmark_doc_render_html(doc, options);
+	}
+	if (cache->doc_id != doc->id) {
+		// the blocks of another document are not these
+		cache->generation++;
+		S_sweep_cache(cache);
+		cache->doc_id = doc->id;
+	}
+	cache->generation++;
+	cache->reused = 0;
+	governor = cmark_document_governor(doc->root);
+	cmark_governor_restart(governor);
+
+	iter = cmark_iter_new(doc->root);
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != doc->root &&
+		    cmark_governor_render_stopped(governor, html.size)) {
+			break;
+		}
+		if (ev_type == CMARK_EVENT_ENTER && S_is_cacheable(doc, cur)) {
+			if (!S_render_block_cached(cache, cur, &state, governor,
+			                           options)) {
+				break;
+			}
+			cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
+		} else {
+			S_render_node(cur, ev_type, &state, options);
+		}
+	}
+	if (ev_type != CMARK_EVENT_DONE) {
+		// close the elements around the block where the render stopped
+		while (cur != doc->root) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, &state, options);
+		}
+	}
 	cmark_iter_free(iter);
-	return result;
+
+	S_sweep_cache(cache);
+	return (char *)cmark_strbuf_detach(&html);
 }
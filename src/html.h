@@ -0,0 +1,21 @@
+#ifndef CMARK_HTML_H
+#define CMARK_HTML_H
+
+#include "cmark.h"
+#include "buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Renders 'root' to HTML at the end of 'html', as cmark_render_html
+// does.  The output so far must be empty or end with a newline, as the
+// HTML of a document does.
+void cmark_render_html_append(cmark_strbuf *html, cmark_node *root,
+                              int options);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
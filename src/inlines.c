@@ -5,6 +5,7 @@
 #include "cmark_ctype.h"
 #include "config.h"
 #include "node.h"
+#include "alloc.h"
 #include "parser.h"
 #include "references.h"
 #include "cmark.h"
@@ -12,6 +13,7 @@
 #include "utf8.h"
 #include "scanners.h"
 #include "inlines.h"
+#include "governor.h"
 
 
 static const char *EMDASH = "\xE2\x80\x94";
@@ -49,7 +51,11 @@ typedef struct {
 	cmark_chunk input;
 	int pos;
 	cmark_reference_map *refmap;
+	cmark_pool *pool;
+	cmark_parser_stats *stats;
+	cmark_governor *governor;
 	delimiter *last_delim;
+	bool merge_text;
 } subject;
 
 static delimiter*
@@ -61,9 +67,31 @@ static void subject_from_buf(subject *e, cmark_strbuf *buffer,
                              cmark_reference_map *refmap);
 static int subject_find_special_char(subject *subj, int options);
 
-static cmark_chunk cmark_clean_autolink(cmark_chunk *url, int is_email)
+// Unescape entities, and backslash escapes if 'backslashes' is set,
+// in 'len' bytes at 'data'.  Returns a slice of 'data' if there is
+// nothing to unescape, otherwise a copy in 'pool'.
+static cmark_chunk S_unescape(cmark_pool *pool, unsigned char *data, int len,
+                              bool backslashes)
 {
-	cmark_strbuf buf = GH_BUF_INIT;
+	cmark_strbuf *buf = &pool->scratch;
+	cmark_chunk result = {data, len, 0};
+
+	if (memchr(data, '&', len) == NULL &&
+	    (!backslashes || memchr(data, '\\', len) == NULL)) {
+		return result;
+	}
+
+	cmark_strbuf_clear(buf);
+	houdini_unescape_html_f(buf, data, len);
+	if (backslashes)
+		cmark_strbuf_unescape(buf);
+	return cmark_pool_put(pool, buf->ptr, buf->size);
+}
+
+static cmark_chunk cmark_clean_autolink(cmark_pool *pool, cmark_chunk *url,
+                                        int is_email)
+{
+	cmark_strbuf *buf = &pool->scratch;
 
 	cmark_chunk_trim(url);
 
@@ -72,16 +100,18 @@ static cmark_chunk cmark_clean_autolink(cmark_chunk *url, int is_email)
 		return result;
 	}
 
-	if (is_email)
-		cmark_strbuf_puts(&buf, "mailto:");
+	if (!is_email)
+		return S_unescape(pool, url->data, url->len, false);
 
-	houdini_unescape_html_f(&buf, url->data, url->len);
-	return cmark_chunk_buf_detach(&buf);
+	cmark_strbuf_clear(buf);
+	cmark_strbuf_puts(buf, "mailto:");
+	houdini_unescape_html_f(buf, url->data, url->len);
+	return cmark_pool_put(pool, buf->ptr, buf->size);
 }
 
 static inline cmark_node *make_link(cmark_node *label, cmark_chunk *url, cmark_chunk *title)
 {
-	cmark_node* e = (cmark_node *)calloc(1, sizeof(*e));
+	cmark_node* e = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*e));
 	if(e != NULL) {
 		e->type = CMARK_NODE_LINK;
 		e->first_child   = label;
@@ -94,9 +124,10 @@ static inline cmark_node *make_link(cmark_node *label, cmark_chunk *url, cmark_c
 	return e;
 }
 
-static inline cmark_node* make_autolink(cmark_node* label, cmark_chunk url, int is_email)
+static inline cmark_node* make_autolink(subject *subj, cmark_node* label,
+                                        cmark_chunk url, int is_email)
 {
-	cmark_chunk clean_url = cmark_clean_autolink(&url, is_email);
+	cmark_chunk clean_url = cmark_clean_autolink(subj->pool, &url, is_email);
 	cmark_chunk title = CMARK_CHUNK_EMPTY;
 	return make_link(label, &clean_url, &title);
 }
@@ -104,7 +135,7 @@ static inline cmark_node* make_autolink(cmark_node* label, cmark_chunk url, int
 // Create an inline with a literal string value.
 static inline cmark_node* make_literal(cmark_node_type t, cmark_chunk s)
 {
-	cmark_node * e = (cmark_node *)calloc(1, sizeof(*e));
+	cmark_node * e = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*e));
 	if(e != NULL) {
 		e->type = t;
 		e->as.literal = s;
@@ -124,7 +155,7 @@ static inline cmark_node* make_literal(cmark_node_type t, cmark_chunk s)
 // Create an inline with no value.
 static inline cmark_node* make_simple(cmark_node_type t)
 {
-	cmark_node* e = (cmark_node *)calloc(1, sizeof(*e));
+	cmark_node* e = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*e));
 	if(e != NULL) {
 		e->type = t;
 		e->next = NULL;
@@ -140,22 +171,6 @@ static inline cmark_node* make_simple(cmark_node_type t)
 	return e;
 }
 
-// Duplicate a chunk by creating a copy of the buffer not by reusing the
-// buffer like cmark_chunk_dup does.
-static cmark_chunk chunk_clone(cmark_chunk *src)
-{
-	cmark_chunk c;
-	int len = src->len;
-
-	c.len   = len;
-	c.data  = (unsigned char *)malloc(len + 1);
-	c.alloc = 1;
-	memcpy(c.data, src->data, len);
-	c.data[len] = '\0';
-
-       return c;
-}
-
 static void subject_from_buf(subject *e, cmark_strbuf *buffer,cmark_reference_map *refmap)
 {
 	e->input.data = buffer->ptr;
@@ -163,7 +178,11 @@ static void subject_from_buf(subject *e, cmark_strbuf *buffer,cmark_reference_ma
 	e->input.alloc = 0;
 	e->pos = 0;
 	e->refmap = refmap;
+	e->pool = refmap ? refmap->pool : NULL;
+	e->stats = refmap ? refmap->stats : NULL;
+	e->governor = refmap ? refmap->governor : NULL;
 	e->last_delim = NULL;
+	e->merge_text = false;
 
 	cmark_chunk_rtrim(&e->input);
 }
@@ -349,17 +368,25 @@ static void remove_delimiter(subject *subj, delimiter *delim)
 	if (delim->previous != NULL) {
 		delim->previous->next = delim->next;
 	}
-	free(delim);
+	CMARK_FREE(delim);
 }
 
 static void push_delimiter(subject *subj, unsigned char c, bool can_open,
                            bool can_close, cmark_node *inl_text)
 {
-	delimiter *delim =
-	    (delimiter*)malloc(sizeof(delimiter));
+	delimiter *delim;
+
+	// past the limit, the delimiter is left as text
+	if (!cmark_governor_add_delimiter(subj->governor)) {
+		return;
+	}
+	delim = (delimiter*)CMARK_MALLOC(OTHER, sizeof(delimiter));
 	if (delim == NULL) {
 		return;
 	}
+	if (subj->stats) {
+		subj->stats->delimiters++;
+	}
 	delim->delim_char = c;
 	delim->can_open = can_open;
 	delim->can_close = can_close;
@@ -415,7 +442,7 @@ static cmark_node* handle_hyphen(subject* subj, bool smart)
 			return make_str(cmark_chunk_literal(ENDASH));
 		}
 	} else {
-		return make_str(cmark_chunk_literal("-"));
+		return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
 	}
 }
 
@@ -429,10 +456,10 @@ static cmark_node* handle_period(subject* subj, bool smart)
 			advance(subj);
 			return make_str(cmark_chunk_literal(ELLIPSES));
 		} else {
-			return make_str(cmark_chunk_literal(".."));
+			return make_str(cmark_chunk_dup(&subj->input, subj->pos - 2, 2));
 		}
 	} else {
-		return make_str(cmark_chunk_literal("."));
+		return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
 	}
 }
 
@@ -440,6 +467,7 @@ static void process_emphasis(subject *subj, delimiter *start_delim)
 {
 	delimiter *closer = subj->last_delim;
 	delimiter *opener;
+	uint64_t steps = 0;
 
 	// move back to first relevant delim.
 	while (closer != NULL && closer->previous != start_delim) {
@@ -459,6 +487,7 @@ static void process_emphasis(subject *subj, delimiter *start_delim)
 					break;
 				}
 				opener = opener->previous;
+				steps++;
 			}
 			if (closer->delim_char == '*' || closer->delim_char == '_') {
 				if (opener != NULL && opener != start_delim) {
@@ -495,6 +524,9 @@ static void process_emphasis(subject *subj, delimiter *start_delim)
 	while (subj->last_delim != start_delim) {
 		remove_delimiter(subj, subj->last_delim);
 	}
+	if (subj->stats) {
+		subj->stats->opener_steps += steps;
+	}
 }
 
 static delimiter*
@@ -545,6 +577,7 @@ S_insert_emph(subject *subj, delimiter *opener, delimiter *closer)
 		// create new emph or strong, and splice it in to our inlines
 		// between the opener and closer
 		emph = use_delims == 1 ? make_emph() : make_strong();
+		cmark_governor_count_node(subj->governor);
 		emph->parent = opener_inl->parent;
 		emph->prev = opener_inl;
 		opener_inl->next = emph;
@@ -588,7 +621,7 @@ static cmark_node* handle_backslash(subject *subj)
 		advance(subj);
 		return make_linebreak();
 	} else {
-		return make_str(cmark_chunk_literal("\\"));
+		return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
 	}
 }
 
@@ -596,12 +629,13 @@ static cmark_node* handle_backslash(subject *subj)
 // Assumes the subject has an '&' character at the current position.
 static cmark_node* handle_entity(subject* subj)
 {
-	cmark_strbuf ent = GH_BUF_INIT;
+	cmark_strbuf *ent = &subj->pool->scratch;
 	size_t len;
 
 	advance(subj);
 
-	len = houdini_unescape_ent(&ent,
+	cmark_strbuf_clear(ent);
+	len = houdini_unescape_ent(ent,
 	                           subj->input.data + subj->pos,
 	                           subj->input.len - subj->pos
 	                          );
@@ -610,28 +644,22 @@ static cmark_node* handle_entity(subject* subj)
 		return make_str(cmark_chunk_literal("&"));
 
 	subj->pos += len;
-	return make_str(cmark_chunk_buf_detach(&ent));
+	return make_str(cmark_pool_put(subj->pool, ent->ptr, ent->size));
 }
 
 // Like make_str, but parses entities.
 // Returns an inline sequence consisting of str and entity elements.
-static cmark_node *make_str_with_entities(cmark_chunk *content)
+static cmark_node *make_str_with_entities(subject *subj, cmark_chunk *content)
 {
-	cmark_strbuf unescaped = GH_BUF_INIT;
-
-	if (houdini_unescape_html(&unescaped, content->data, (size_t)content->len)) {
-		return make_str(cmark_chunk_buf_detach(&unescaped));
-	} else {
-		return make_str(*content);
-	}
+	return make_str(S_unescape(subj->pool, content->data, content->len,
+	                           false));
 }
 
 // Clean a URL: remove surrounding whitespace and surrounding <>,
-// and remove \ that escape punctuation.
-cmark_chunk cmark_clean_url(cmark_chunk *url)
+// and remove \ that escape punctuation.  The result is a slice of
+// 'url' unless something had to be unescaped.
+cmark_chunk cmark_clean_url(cmark_pool *pool, cmark_chunk *url)
 {
-	cmark_strbuf buf = GH_BUF_INIT;
-
 	cmark_chunk_trim(url);
 
 	if (url->len == 0) {
@@ -640,18 +668,14 @@ cmark_chunk cmark_clean_url(cmark_chunk *url)
 	}
 
 	if (url->data[0] == '<' && url->data[url->len - 1] == '>') {
-		houdini_unescape_html_f(&buf, url->data + 1, url->len - 2);
+		return S_unescape(pool, url->data + 1, url->len - 2, true);
 	} else {
-		houdini_unescape_html_f(&buf, url->data, url->len);
+		return S_unescape(pool, url->data, url->len, true);
 	}
-
-	cmark_strbuf_unescape(&buf);
-	return cmark_chunk_buf_detach(&buf);
 }
 
-cmark_chunk cmark_clean_title(cmark_chunk *title)
+cmark_chunk cmark_clean_title(cmark_pool *pool, cmark_chunk *title)
 {
-	cmark_strbuf buf = GH_BUF_INIT;
 	unsigned char first, last;
 
 	if (title->len == 0) {
@@ -666,13 +690,10 @@ cmark_chunk cmark_clean_title(cmark_chunk *title)
 	if ((first == '\'' && last == '\'') ||
 	    (first == '(' && last == ')') ||
 	    (first == '"' && last == '"')) {
-		houdini_unescape_html_f(&buf, title->data + 1, title->len - 2);
+		return S_unescape(pool, title->data + 1, title->len - 2, true);
 	} else {
-		houdini_unescape_html_f(&buf, title->data, title->len);
+		return S_unescape(pool, title->data, title->len, true);
 	}
-
-	cmark_strbuf_unescape(&buf);
-	return cmark_chunk_buf_detach(&buf);
 }
 
 // Parse an autolink or HTML tag.
@@ -702,7 +723,7 @@ static cmark_node* handle_pointy_brace(subject* subj)
 		contents = cmark_chunk_dup(&subj->input, subj->pos, matchlen - 1);
 		subj->pos += matchlen;
 
-		return make_autolink(make_str(contents),contents, 0);
+		return make_autolink(subj, make_str(contents), contents, 0);
     }
     else if(inline_match>0)
     {
@@ -720,7 +741,7 @@ static cmark_node* handle_pointy_brace(subject* subj)
 
         //advance subject so that you don't add the > at the end of the link
         advance(subj);
-        return make_autolink(make_str(label),contents,0);
+        return make_autolink(subj, make_str(label), contents, 0);
     }
 
 	// next try to match an email autolink
@@ -729,8 +750,8 @@ static cmark_node* handle_pointy_brace(subject* subj)
 		contents = cmark_chunk_dup(&subj->input, subj->pos, matchlen - 1);
 		subj->pos += matchlen;
 
-		return make_autolink(
-            make_str_with_entities(&contents),
+		return make_autolink(subj,
+            make_str_with_entities(subj, &contents),
 		           contents, 1
 		       );
 	}
@@ -798,6 +819,7 @@ static cmark_node* handle_close_curly_brace(subject* subj,cmark_node* parent)
 {
     delimiter *opener = subj->last_delim;
     cmark_node *inl;
+    cmark_chunk name;
     advance(subj); //advance past }
     while(opener)
     {
@@ -809,25 +831,38 @@ static cmark_node* handle_close_curly_brace(subject* subj,cmark_node* parent)
     }
     if(opener == NULL)
     {
-        return make_str(cmark_chunk_literal("}"));
+        return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
     }
     if(!opener->active)
     {
         remove_delimiter(subj,opener);
-        return make_str(cmark_chunk_literal("}"));
+        return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
+    }
+    //came here so have a full inline link. Its name is the input between
+    //the {# and the }, which may have been parsed into several nodes (smart
+    //punctuation splits "a-b"); they are all dropped, with their delimiters
+    name = cmark_chunk_dup(&subj->input, opener->position,
+                           subj->pos - 1 - opener->position);
+    if(name.len == 0)
+    {
+        remove_delimiter(subj,opener);
+        return make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
     }
-    //came here so have a full inline link
     inl = opener->inl_text;
-    inl->type = NODE_INLINE_LINK;
-    cmark_node* tag_name = opener->inl_text->next;
-    cmark_chunk_free(&inl->as.literal);
-    if(!cmark_node_set_literal(inl,cmark_node_get_literal(tag_name)))
+    while(subj->last_delim != opener)
+    {
+        remove_delimiter(subj,subj->last_delim);
+    }
+    remove_delimiter(subj,opener);
+    while(inl->next)
     {
-        fprintf(stderr,"Couldn't set literal. Exiting! \n");
-        exit(1);
+        cmark_node_free(inl->next);
     }
-    cmark_node_free(tag_name);
-    inl->next = NULL;
+    inl->type = NODE_INLINE_LINK;
+    cmark_chunk_free(&inl->as.literal);
+    //a copy that the node owns
+    cmark_chunk_to_cstr(&name);
+    inl->as.literal = name;
     cmark_node_unlink(inl);
     cmark_node_prepend_child(parent,inl);
     return NULL;
@@ -863,14 +898,14 @@ static cmark_node* handle_close_bracket(subject* subj, cmark_node *parent)
 	}
 
 	if (opener == NULL) {
-		return make_str(cmark_chunk_literal("]"));
+		return make_str(cmark_chunk_dup(&subj->input, initial_pos - 1, 1));
 	}
 
 	if (!opener->active) {
 		// take delimiter off stack
         //could happen if you had 2 [[
 		remove_delimiter(subj, opener);
-		return make_str(cmark_chunk_literal("]"));
+		return make_str(cmark_chunk_dup(&subj->input, initial_pos - 1, 1));
 	}
 
 	// If we got here, we matched a potential link/image text.
@@ -901,8 +936,8 @@ static cmark_node* handle_close_bracket(subject* subj, cmark_node *parent)
 
 			url_chunk = cmark_chunk_dup(&subj->input, starturl, endurl - starturl);
 			title_chunk = cmark_chunk_dup(&subj->input, starttitle, endtitle - starttitle);
-			url = cmark_clean_url(&url_chunk);
-			title = cmark_clean_title(&title_chunk);
+			url = cmark_clean_url(subj->pool, &url_chunk);
+			title = cmark_clean_title(subj->pool, &title_chunk);
 			cmark_chunk_free(&url_chunk);
 			cmark_chunk_free(&title_chunk);
 			goto match;
@@ -931,8 +966,9 @@ static cmark_node* handle_close_bracket(subject* subj, cmark_node *parent)
 	cmark_chunk_free(&raw_label);
 
 	if (ref != NULL) { // found
-		url   = chunk_clone(&ref->url);
-		title = chunk_clone(&ref->title);
+		// links to the same reference share its pooled strings
+		url   = ref->url;
+		title = ref->title;
 		goto match;
 	} else {
 		goto noMatch;
@@ -942,7 +978,7 @@ noMatch:
 	// If we fall through to here, it means we didn't match a link:
 	remove_delimiter(subj, opener);  // remove this opener from delimiter list
 	subj->pos = initial_pos;
-	return make_str(cmark_chunk_literal("]"));
+	return make_str(cmark_chunk_dup(&subj->input, initial_pos - 1, 1));
 
 match:
 	inl = opener->inl_text;
@@ -1063,6 +1099,27 @@ static int subject_find_special_char(subject *subj, int options)
 }
 
 
+// Append 'inl' to 'parent', or extend the text node before it instead
+// when both are text that directly follow each other in the input.
+// The node of the last delimiter is left alone, as emphasis, links and
+// anchors will still change it.
+static void append_inline(subject *subj, cmark_node *parent, cmark_node *inl)
+{
+	cmark_node *last = parent->last_child;
+	cmark_node *delim_inl = subj->last_delim ? subj->last_delim->inl_text : NULL;
+
+	if (last != NULL && inl->type == NODE_TEXT && last->type == NODE_TEXT &&
+	    !inl->as.literal.alloc && !last->as.literal.alloc &&
+	    last->as.literal.data + last->as.literal.len == inl->as.literal.data &&
+	    last != delim_inl && inl != delim_inl && subj->merge_text) {
+		last->as.literal.len += inl->as.literal.len;
+		cmark_node_free(inl);
+		return;
+	}
+	cmark_node_append_child(parent, inl);
+	cmark_governor_count_node(subj->governor);
+}
+
 // Parse an inline, advancing subject, and add it as a child of parent.
 // Return 0 if no inline can be parsed, 1 otherwise.
 static int parse_inline(subject* subj, cmark_node * parent, int options)
@@ -1105,7 +1162,7 @@ static int parse_inline(subject* subj, cmark_node * parent, int options)
 		break;
 	case '[':
 		advance(subj);
-		new_inl = make_str(cmark_chunk_literal("["));
+		new_inl = make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
 		push_delimiter(subj, '[', true, false, new_inl);
 		break;
 	case ']':
@@ -1117,13 +1174,13 @@ static int parse_inline(subject* subj, cmark_node * parent, int options)
         if(peek_char(subj)=='#')
         {
             advance(subj);
-            new_inl = make_str(cmark_chunk_literal("{#"));
+            new_inl = make_str(cmark_chunk_dup(&subj->input, subj->pos - 2, 2));
             //delimeter stack with delimiter={ open = true closed = false and text = {#
             push_delimiter(subj,'{',true,false,new_inl);
         }
         else
         {
-            new_inl = make_str(cmark_chunk_literal("{"));
+            new_inl = make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
         }
         break;
     case '}':
@@ -1133,10 +1190,10 @@ static int parse_inline(subject* subj, cmark_node * parent, int options)
 		advance(subj);
 		if (peek_char(subj) == '[') {
 			advance(subj);
-			new_inl = make_str(cmark_chunk_literal("!["));
+			new_inl = make_str(cmark_chunk_dup(&subj->input, subj->pos - 2, 2));
 			push_delimiter(subj, '!', false, true, new_inl);
 		} else {
-			new_inl = make_str(cmark_chunk_literal("!"));
+			new_inl = make_str(cmark_chunk_dup(&subj->input, subj->pos - 1, 1));
 		}
 		break;
 	default:
@@ -1151,20 +1208,46 @@ static int parse_inline(subject* subj, cmark_node * parent, int options)
 		new_inl = make_str(contents);
 	}
 	if (new_inl != NULL) {
-        cmark_node_append_child(parent, new_inl);
+		append_inline(subj, parent, new_inl);
 	}
 	return 1;
 }
 
+// Counts the nodes below 'parent' for the stats.
+static void S_count_nodes(cmark_parser_stats *stats, cmark_node *parent)
+{
+	cmark_iter *iter = cmark_iter_new(parent);
+	cmark_event_type ev_type;
+	cmark_node *cur;
+
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != parent) {
+			stats->nodes[cur->type]++;
+		}
+	}
+	cmark_iter_free(iter);
+}
+
 // Parse inlines from parent's string_content, adding as children of parent.
 extern void cmark_parse_inlines(cmark_node* parent, cmark_reference_map *refmap, int options)
 {
 	subject subj;
 	subject_from_buf(&subj, &parent->string_content, refmap);
+	subj.merge_text = true;
     //parse inline parses special character groups at a tme so [,],{,} and other special characters are parsed as only single characters when parse_inline is called
-	while (!is_eof(&subj) && parse_inline(&subj, parent, options)) ;
+	while (!is_eof(&subj) && !cmark_governor_parse_stopped(subj.governor) &&
+	       parse_inline(&subj, parent, options)) ;
+	if (subj.governor && !is_eof(&subj)) {
+		// a limit stopped the parse: the rest is text
+		cmark_node_append_child(parent, make_str(cmark_chunk_dup(
+		    &subj.input, subj.pos, subj.input.len - subj.pos)));
+	}
 
 	process_emphasis(&subj, NULL);
+	if (subj.stats) {
+		S_count_nodes(subj.stats, parent);
+	}
 }
 
 // Parse zero or more space characters, including at most one newline.
@@ -1178,11 +1261,11 @@ static void spnl(subject* subj)
 	}
 }
 
-// Parse reference.  Assumes string begins with '[' character.
+// Parse reference.  Assumes string has a '[' character at 'offset'.
 // Modify refmap if a reference is encountered.
-// Return 0 if no reference found, otherwise position of subject
-// after reference is parsed.
-int cmark_parse_reference_inline(cmark_strbuf *input, cmark_reference_map *refmap)
+// Return 0 if no reference found, otherwise the length of the
+// reference.
+int cmark_parse_reference_inline(cmark_strbuf *input, int offset, cmark_reference_map *refmap)
 {
 	subject subj;
 
@@ -1194,6 +1277,7 @@ int cmark_parse_reference_inline(cmark_strbuf *input, cmark_reference_map *refma
 	int beforetitle;
 
 	subject_from_buf(&subj, input, NULL);
+	subj.pos = offset;
 
 	// parse label:
     //will parse only the stuff between [Link Label]
@@ -1240,14 +1324,13 @@ int cmark_parse_reference_inline(cmark_strbuf *input, cmark_reference_map *refma
 	}
 	// insert reference into refmap
 	cmark_reference_create(refmap, &lab, &url, &title);
-    return subj.pos;
+    return subj.pos - offset;
 }
 
-// Parse includes.  Assumes string begins with '<<' character.
+// Parse includes.  Assumes string has '<<' at 'offset'.
 // Add an include node to the head of the document in case include is found
-// Return 0 if no reference found, otherwise position of subject
-// after include is parsed.
-int cmark_parse_include_inline(cmark_strbuf *input,cmark_parser *parser)
+// Return 0 if no reference found, otherwise the length of the include.
+int cmark_parse_include_inline(cmark_strbuf *input, int offset, cmark_parser *parser)
 {
     subject subj;
     cmark_chunk file;
@@ -1255,6 +1338,7 @@ int cmark_parse_include_inline(cmark_strbuf *input,cmark_parser *parser)
     
     int matchlen = 0;
     subject_from_buf(&subj,input,NULL);
+    subj.pos = offset;
     spnl(&subj);
     matchlen = scan_link_url(&subj.input, subj.pos);
     if (matchlen) {
@@ -1267,7 +1351,7 @@ int cmark_parse_include_inline(cmark_strbuf *input,cmark_parser *parser)
         }
         if(file.data[file.len-1]=='>' && file.data[file.len-2]=='>')
         {
-            filename = malloc(sizeof(char)*file.len);
+            filename = CMARK_MALLOC(OTHER, sizeof(char)*file.len);
 //            //advancing by 2 because don't want to include the << at the start
             memcpy(filename,(char*)file.data+2,file.len-2);
             filename[file.len-4] = '\0';
@@ -1289,21 +1373,21 @@ int cmark_parse_include_inline(cmark_strbuf *input,cmark_parser *parser)
     } else if (peek_char(&subj) != 0) {
         return 0;
     }
-    free(filename);
-    return subj.pos;
+    CMARK_FREE(filename);
+    return subj.pos - offset;
 }
 
-// Parse table of contents.  Assumes string begins with '{' character.
+// Parse table of contents.  Assumes string has a '{' at 'offset'.
 // Add a new table of contents node in case a toc is found
-// Return 0 if no reference found, otherwise position of subject
-// after toc is parsed.
-int cmark_parse_toc_inline(cmark_strbuf *input,cmark_parser *parser)
+// Return 0 if no reference found, otherwise the length of the toc.
+int cmark_parse_toc_inline(cmark_strbuf *input, int offset, cmark_parser *parser)
 {
     subject subj;
     cmark_chunk depth;
     int matchlen = 0;
     int maxDepth = -1;
     subject_from_buf(&subj,input,NULL);
+    subj.pos = offset;
     spnl(&subj);
     int pos;
     matchlen = scan_toc_inline(&subj.input,subj.pos);
@@ -1317,7 +1401,10 @@ int cmark_parse_toc_inline(cmark_strbuf *input,cmark_parser *parser)
         }
         subj.pos+=matchlen;
         cmark_node *toc = cmark_node_new(NODE_TOC);
-        toc->user_data = malloc(sizeof(char)*4);
+        if (parser->stats) {
+            parser->stats->nodes[NODE_TOC]++;
+        }
+        toc->user_data = CMARK_MALLOC(OTHER, sizeof(char)*4);
         sprintf(toc->user_data,"%d",maxDepth);
         cmark_node_append_child(parser->current->parent,toc);
     }
@@ -1334,5 +1421,5 @@ int cmark_parse_toc_inline(cmark_strbuf *input,cmark_parser *parser)
     } else if (peek_char(&subj) != 0) {
         return 0;
     }
-    return subj.pos;
+    return subj.pos - offset;
 }
@@ -5,16 +5,16 @@
 extern "C" {
 #endif
 
-cmark_chunk cmark_clean_url(cmark_chunk *url);
-cmark_chunk cmark_clean_title(cmark_chunk *title);
+cmark_chunk cmark_clean_url(cmark_pool *pool, cmark_chunk *url);
+cmark_chunk cmark_clean_title(cmark_pool *pool, cmark_chunk *title);
 
 void cmark_parse_inlines(cmark_node* parent, cmark_reference_map *refmap, int options);
 
-int cmark_parse_reference_inline(cmark_strbuf *input, cmark_reference_map *refmap);
+int cmark_parse_reference_inline(cmark_strbuf *input, int offset, cmark_reference_map *refmap);
     
-int cmark_parse_include_inline(cmark_strbuf *input,cmark_parser *parser);
+int cmark_parse_include_inline(cmark_strbuf *input, int offset, cmark_parser *parser);
     
-int cmark_parse_toc_inline(cmark_strbuf *input, cmark_parser *parser);
+int cmark_parse_toc_inline(cmark_strbuf *input, int offset, cmark_parser *parser);
 
 #ifdef __cplusplus
 }
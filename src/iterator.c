@@ -3,6 +3,7 @@
 
 #include "config.h"
 #include "node.h"
+#include "alloc.h"
 #include "cmark.h"
 #include "iterator.h"
 
@@ -22,7 +23,7 @@ cmark_iter_new(cmark_node *root)
 	if (root == NULL) {
 		return NULL;
 	}
-	cmark_iter *iter = (cmark_iter*)malloc(sizeof(cmark_iter));
+	cmark_iter *iter = (cmark_iter*)CMARK_MALLOC(OTHER, sizeof(cmark_iter));
 	if (iter == NULL) {
 		return NULL;
 	}
@@ -37,13 +38,19 @@ cmark_iter_new(cmark_node *root)
 void
 cmark_iter_free(cmark_iter *iter)
 {
-	free(iter);
+	CMARK_FREE(iter);
+}
+
+bool
+cmark_node_type_is_leaf(cmark_node_type type)
+{
+	return (1 << type) & S_leaf_mask;
 }
 
 static bool
 S_is_leaf(cmark_node *node)
 {
-	return (1 << node->type) & S_leaf_mask;
+	return cmark_node_type_is_leaf(node->type);
 }
 
 cmark_event_type
@@ -53,6 +60,17 @@ cmark_iter_next(cmark_iter *iter)
 	cmark_event_type  ev_type = iter->next.ev_type;
 	cmark_node       *node    = iter->next.node;
 
+	if (ev_type == CMARK_EVENT_NONE) {
+		/* going on to the children of a node with pending inlines */
+		cmark_node_ensure_inlines(node);
+		if (node->first_child) {
+			ev_type = CMARK_EVENT_ENTER;
+			node    = node->first_child;
+		} else {
+			ev_type = CMARK_EVENT_EXIT;
+		}
+	}
+
 	iter->cur.ev_type = ev_type;
 	iter->cur.node    = node;
     
@@ -62,9 +80,15 @@ cmark_iter_next(cmark_iter *iter)
 
 	/* roll forward to next item, setting both fields */
 	if (ev_type == CMARK_EVENT_ENTER && !S_is_leaf(node)) {
-		if (node->first_child == NULL) {
+		if (node->pending_inlines) {
+			/* parse them only if the caller does not skip the
+			 * children with cmark_iter_reset */
+			iter->next.ev_type = CMARK_EVENT_NONE;
+			iter->next.node    = node;
+		} else if (node->first_child == NULL) {
 			/* stay on this node but exit */
 			iter->next.ev_type = CMARK_EVENT_EXIT;
+			iter->next.node    = node;
 		} else {
 			iter->next.ev_type = CMARK_EVENT_ENTER;
 			iter->next.node    = node->first_child;
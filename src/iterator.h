@@ -5,6 +5,7 @@
 extern "C" {
 #endif
 
+#include "config.h"
 #include "cmark.h"
 
 typedef struct {
@@ -18,6 +19,9 @@ struct cmark_iter {
 	cmark_iter_state  next;
 };
 
+/* Returns true for node types that never get an EXIT event. */
+bool cmark_node_type_is_leaf(cmark_node_type type);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,7 +5,6 @@
 #include "config.h"
 #include "cmark.h"
 #include "debug.h"
-#include "bench.h"
 
 #if defined(_WIN32) && !defined(__CYGWIN__)
 #include <io.h>
@@ -21,6 +20,12 @@ typedef enum {
 	FORMAT_COMMONMARK
 } writer_format;
 
+typedef enum {
+	STATS_NONE,
+	STATS_TEXT,
+	STATS_JSON
+} stats_format;
+
 int can_include(char *filename)
 {
     if(strstr(filename,".css")||strstr(filename,".js"))
@@ -38,6 +43,10 @@ void print_usage()
 	printf("  --hardbreaks     Treat newlines as hard line breaks\n");
 	printf("  --smart          Use smart punctuation\n");
 	printf("  --normalize      Consolidate adjacent text nodes\n");
+	printf("  --retain-input   Refer to the input instead of copying code\n");
+	printf("  --lazy-inlines   Parse inline content only when it is rendered\n");
+	printf("  --blocks-only    Parse the block structure only\n");
+	printf("  --stats[=json]   Print timings and work counts to stderr\n");
 	printf("  --help, -h       Print usage information\n");
 	printf("  --version        Print version\n");
 }
@@ -68,20 +77,78 @@ static void print_document(cmark_node *document, writer_format writer,
 	free(result);
 }
 
+static void print_stats(cmark_parser_stats *stats, stats_format format)
+{
+	const struct {
+		const char *name;
+		uint64_t value;
+	} fields[] = {
+		{ "lines_ns", stats->lines_ns },
+		{ "finalize_ns", stats->finalize_ns },
+		{ "inlines_ns", stats->inlines_ns },
+		{ "postprocess_ns", stats->postprocess_ns },
+		{ "render_ns", stats->render_ns },
+		{ "free_ns", stats->free_ns },
+		{ "bytes", stats->bytes },
+		{ "lines", stats->lines },
+		{ "delimiters", stats->delimiters },
+		{ "opener_steps", stats->opener_steps },
+		{ "ref_lookups", stats->ref_lookups },
+		{ "ref_hits", stats->ref_hits },
+		{ "ref_chain_steps", stats->ref_chain_steps },
+		{ "buf_reallocs", stats->buf_reallocs },
+		{ "peak_content", stats->peak_content },
+	};
+	size_t n = sizeof(fields) / sizeof(fields[0]);
+	size_t i;
+	int type;
+	const char *sep = "";
+
+	if (format == STATS_JSON) {
+		fprintf(stderr, "{");
+		for (i = 0; i < n; i++) {
+			fprintf(stderr, "%s\"%s\": %llu", i ? ", " : "",
+			        fields[i].name, (unsigned long long)fields[i].value);
+		}
+		fprintf(stderr, ", \"nodes\": {");
+		for (type = 0; type <= CMARK_NODE_LAST_INLINE; type++) {
+			if (stats->nodes[type]) {
+				fprintf(stderr, "%s\"%s\": %llu", sep,
+				        cmark_node_type_string((cmark_node_type)type),
+				        (unsigned long long)stats->nodes[type]);
+				sep = ", ";
+			}
+		}
+		fprintf(stderr, "}}\n");
+	} else {
+		for (i = 0; i < n; i++) {
+			fprintf(stderr, "%-16s %12llu\n", fields[i].name,
+			        (unsigned long long)fields[i].value);
+		}
+		for (type = 0; type <= CMARK_NODE_LAST_INLINE; type++) {
+			if (stats->nodes[type]) {
+				fprintf(stderr, "nodes.%-10s %12llu\n",
+				        cmark_node_type_string((cmark_node_type)type),
+				        (unsigned long long)stats->nodes[type]);
+			}
+		}
+	}
+}
+
 int main(int argc, char *argv[])
 {
     int i =1;
 	int numfps = 0;
     int numincludes = 0;
 	int *files, *includes;
-	char buffer[4096];
 	cmark_parser *parser;
-	size_t bytes;
 	cmark_node *document;
 	int width = 0;
 	char *unparsed;
 	writer_format writer = FORMAT_HTML;
 	int options = CMARK_OPT_DEFAULT;
+	stats_format stats_output = STATS_NONE;
+	cmark_parser_stats stats;
 
 #if defined(_WIN32) && !defined(__CYGWIN__)
 	_setmode(_fileno(stdout), _O_BINARY);
@@ -102,6 +169,16 @@ int main(int argc, char *argv[])
 			options |= CMARK_OPT_SMART;
 		} else if (strcmp(argv[i], "--normalize") == 0) {
 			options |= CMARK_OPT_NORMALIZE;
+		} else if (strcmp(argv[i], "--retain-input") == 0) {
+			options |= CMARK_OPT_RETAIN_INPUT;
+		} else if (strcmp(argv[i], "--lazy-inlines") == 0) {
+			options |= CMARK_OPT_LAZY_INLINES;
+		} else if (strcmp(argv[i], "--blocks-only") == 0) {
+			options |= CMARK_OPT_BLOCKS_ONLY;
+		} else if (strcmp(argv[i], "--stats") == 0) {
+			stats_output = STATS_TEXT;
+		} else if (strcmp(argv[i], "--stats=json") == 0) {
+			stats_output = STATS_JSON;
 		} else if ((strcmp(argv[i], "--help") == 0) ||
 		           (strcmp(argv[i], "-h") == 0)) {
 			print_usage();
@@ -185,6 +262,10 @@ int main(int argc, char *argv[])
     
 
 	parser = cmark_parser_new(options);
+	if (stats_output != STATS_NONE) {
+		memset(&stats, 0, sizeof(stats));
+		cmark_parser_set_stats(parser, &stats);
+	}
 	for (i = 0; i < numfps; i++) {
 		FILE *fp = fopen(argv[files[i]], "r");
 		if (fp == NULL) {
@@ -193,43 +274,27 @@ int main(int argc, char *argv[])
 			exit(1);
 		}
 
-		start_timer();
-		while ((bytes = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
-			cmark_parser_feed(parser, buffer, bytes);
-			if (bytes < sizeof(buffer)) {
-				break;
-			}
-		}
-		end_timer("processing lines");
+		cmark_parser_feed_file(parser, fp);
 
 		fclose(fp);
 	}
 
 	if (numfps == 0) {
-		while ((bytes = fread(buffer, 1, sizeof(buffer), stdin)) > 0) {
-            //in case user types markdown file in command
-            //line
-			cmark_parser_feed(parser, buffer, bytes);
-			if (bytes < sizeof(buffer)) {
-				break;
-			}
-		}
+		cmark_parser_feed_file(parser, stdin);
 	}
 
-	start_timer();
 	document = cmark_parser_finish(parser);
     cmark_parser_free(parser);
     //In case additional files were passed in to be included in the command line
     cmark_include_files(document,argv,includes,numincludes);
-	end_timer("finishing document");
 
-	start_timer();
 	print_document(document, writer, options, width);
-	end_timer("print_document");
 
-	start_timer();
 	cmark_node_free(document);
-	end_timer("free_blocks");
+
+	if (stats_output != STATS_NONE) {
+		print_stats(&stats, stats_output);
+	}
 
 	free(files);
     free(includes);
@@ -8,6 +8,9 @@
 #include "node.h"
 #include "buffer.h"
 #include "utf8.h"
+#include "stats.h"
+#include "trace.h"
+#include "governor.h"
 
 // Functions to convert cmark_nodes to groff man strings.
 
@@ -86,6 +89,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
               struct render_state *state)
 {
 	cmark_node *tmp;
+	cmark_chunk *code;
 	cmark_strbuf *man = state->man;
 	int list_number;
 	bool entering = (ev_type == CMARK_EVENT_ENTER);
@@ -169,8 +173,8 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 	case CMARK_NODE_CODE_BLOCK:
 		cr(man);
 		cmark_strbuf_puts(man, ".IP\n.nf\n\\f[C]\n");
-		escape_man(man, node->as.code.literal.data,
-		           node->as.code.literal.len);
+		code = cmark_node_literal(node);
+		escape_man(man, code->data, code->len);
 		cr(man);
 		cmark_strbuf_puts(man, "\\f[]\n.fi");
 		cr(man);
@@ -267,21 +271,40 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 
 char *cmark_render_man(cmark_node *root, int options)
 {
+	cmark_parser_stats *stats = cmark_document_stats(root);
+	cmark_governor *governor = cmark_document_governor(root);
+	uint64_t inlines = stats ? stats->inlines_ns : 0;
+	uint64_t start = cmark_stats_start(stats);
 	char *result;
 	cmark_strbuf man = GH_BUF_INIT;
 	struct render_state state = { &man, NULL };
-	cmark_node *cur;
+	cmark_node *cur = NULL;
 	cmark_event_type ev_type;
 	cmark_iter *iter = cmark_iter_new(root);
 
+	cmark_trace_begin(RENDER, cmark_document_id(root), 0, stats);
 	if (options == 0) options = 0; // avoid warning about unused parameters
 
 	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
 		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != root &&
+		    cmark_governor_render_stopped(governor, man.size)) {
+			break;
+		}
 		S_render_node(cur, ev_type, &state);
 	}
+	if (ev_type != CMARK_EVENT_DONE) {
+		// end the blocks around the first node left out
+		while (cur != root) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, &state);
+		}
+	}
 	result = (char *)cmark_strbuf_detach(&man);
 
 	cmark_iter_free(iter);
+	// inlines parsed lazily during the render were timed apart
+	cmark_stats_end(stats, render_ns, start + (stats->inlines_ns - inlines));
+	cmark_trace_end(RENDER, cmark_document_id(root), 0, stats);
 	return result;
 }
@@ -3,6 +3,16 @@
 
 #include "config.h"
 #include "node.h"
+#include "alloc.h"
+#include "parser.h"
+#include "references.h"
+#include "inlines.h"
+#include "stats.h"
+#include "trace.h"
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 static void
 S_node_unlink(cmark_node *node);
@@ -85,7 +95,7 @@ S_can_contain(cmark_node *node, cmark_node *child)
 cmark_node*
 cmark_node_new(cmark_node_type type)
 {
-	cmark_node *node = (cmark_node *)calloc(1, sizeof(*node));
+	cmark_node *node = (cmark_node *)CMARK_CALLOC(NODES, 1, sizeof(*node));
 	node->type = type;
 
 	switch (node->type) {
@@ -108,23 +118,202 @@ cmark_node_new(cmark_node_type type)
 	return node;
 }
 
+static void
+S_free_slices(cmark_node *node)
+{
+	if (node->slices) {
+		CMARK_FREE(node->slices->items);
+		CMARK_FREE(node->slices);
+		node->slices = NULL;
+	}
+}
+
+// Returns the input retained by the document 'node' belongs to, or
+// NULL if there is none.
+static const unsigned char *
+S_retained_input(cmark_node *node)
+{
+	while (node->parent) {
+		node = node->parent;
+	}
+	if (node->type != NODE_DOCUMENT ||
+	    (node->as.document.input.size == 0 &&
+	     node->as.document.map == NULL)) {
+		return NULL;
+	}
+	return cmark_document_input(&node->as.document);
+}
+
+void
+cmark_node_resolve_literal(cmark_node *node)
+{
+	cmark_slices *slices = node->slices;
+	const unsigned char *input = S_retained_input(node);
+	cmark_chunk *literal = node->type == NODE_CODE_BLOCK ?
+	                       &node->as.code.literal : &node->as.literal;
+	cmark_strbuf buf = GH_BUF_INIT;
+	int i;
+
+	cmark_chunk_free(literal);
+	if (input == NULL) {
+		// only reachable if the input was freed; nothing to join
+	} else if (slices->size == 1) {
+		literal->data = (unsigned char *)input + slices->items[0].offset;
+		literal->len = slices->items[0].len;
+	} else {
+		for (i = 0; i < slices->size; i++) {
+			cmark_strbuf_put(&buf, input + slices->items[i].offset,
+			                 slices->items[i].len);
+		}
+		*literal = cmark_chunk_buf_detach(&buf);
+	}
+	S_free_slices(node);
+}
+
+void
+cmark_node_parse_pending_inlines(cmark_node *node)
+{
+	cmark_node *root = node;
+	cmark_document *doc;
+	uint64_t start;
+
+	// cleared first, as parsing appends to the node
+	node->pending_inlines = false;
+	while (root->parent) {
+		root = root->parent;
+	}
+	if (root->type != NODE_DOCUMENT ||
+	    root->as.document.refmap == NULL) {
+		// only reachable for a node that left its document
+		return;
+	}
+	doc = &root->as.document;
+	start = cmark_stats_start(doc->stats);
+	cmark_parse_inlines(node, doc->refmap, doc->options);
+	if (doc->options & CMARK_OPT_NORMALIZE) {
+		cmark_consolidate_text_nodes(node);
+	}
+	cmark_stats_end(doc->stats, inlines_ns, start);
+}
+
+// Returns the top-level block of a cmark_doc that 'node' is in, with
+// the root of the document in 'root', or NULL if it left the document.
+static cmark_node *S_top_level_block(cmark_node *node, cmark_node **root)
+{
+	cmark_node *cur = node;
+
+	while (cur->parent) {
+		cur = cur->parent;
+	}
+	if (cur == node || cur->type != NODE_DOCUMENT) {
+		return NULL;
+	}
+	*root = cur;
+	// a child of the root, or of the body it has with includes
+	while (node->parent != cur &&
+	       !(node->parent->type == NODE_BODY && node->parent->parent == cur)) {
+		node = node->parent;
+	}
+	return node;
+}
+
+static void S_pending_shift(cmark_document *doc, cmark_node *block,
+                            int *delta, int *line_delta, bool take)
+{
+	cmark_shift *shift;
+	int i;
+
+	*delta = 0;
+	*line_delta = 0;
+	for (i = block->shifts_applied; i < doc->shifts_size; i++) {
+		// in the positions of before that edit
+		shift = &doc->shifts[i];
+		if (block->start_offset + *delta >= shift->offset) {
+			*delta += shift->delta;
+			*line_delta += shift->line_delta;
+			shift->taken = shift->taken || take;
+		}
+	}
+}
+
+void cmark_document_pending_shift(cmark_node *root, cmark_node *block,
+                                  int *delta, int *line_delta)
+{
+	S_pending_shift(&root->as.document, block, delta, line_delta, false);
+}
+
+void cmark_node_apply_shifts(cmark_node *node)
+{
+	cmark_node *root = NULL;
+	cmark_node *block = S_top_level_block(node, &root);
+	cmark_iter *iter;
+	cmark_event_type ev_type;
+	cmark_node *cur;
+	int delta;
+	int line_delta;
+
+	if (block == NULL ||
+	    block->shifts_applied == root->as.document.shifts_size) {
+		return;
+	}
+	S_pending_shift(&root->as.document, block, &delta, &line_delta, true);
+	block->shifts_applied = root->as.document.shifts_size;
+	if (delta == 0 && line_delta == 0) {
+		return;
+	}
+	// only blocks have positions to move, so inlines are skipped
+	iter = cmark_iter_new(block);
+	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
+		cur = cmark_iter_get_node(iter);
+		if (ev_type != CMARK_EVENT_ENTER) {
+			continue;
+		}
+		if (cur->start_line != 0) {
+			cur->start_line += line_delta;
+			cur->end_line += line_delta;
+		}
+		if (S_is_block(cur)) {
+			cur->start_offset += delta;
+			cur->end_offset += delta;
+		}
+		if (cur->type == NODE_PARAGRAPH || cur->type == NODE_HEADER) {
+			cmark_iter_reset(iter, cur, CMARK_EVENT_EXIT);
+		}
+	}
+	cmark_iter_free(iter);
+}
+
 // Free a cmark_node list and any children.
 static
 void S_free_nodes(cmark_node *e)
 {
 	cmark_node *next;
+	cmark_node *child;
 	while (e != NULL) {
 		if (S_is_block(e)) {
 			cmark_strbuf_free(&e->string_content);
+			S_free_slices(e);
             if(e->type==NODE_HEADER || e->type == NODE_PARAGRAPH)
             {
                 if(e->user_data!=NULL)
                 {
-                    free(e->user_data);
+                    CMARK_FREE(e->user_data);
                 }
             }
 		}
 		switch (e->type) {
+		case NODE_DOCUMENT:
+			cmark_strbuf_free(&e->as.document.input);
+			cmark_pool_free(e->as.document.pool);
+			cmark_reference_map_free(e->as.document.refmap);
+			CMARK_FREE(e->as.document.shifts);
+			CMARK_FREE(e->as.document.governor);
+#ifdef HAVE_MMAP
+			if (e->as.document.map) {
+				munmap(e->as.document.map, e->as.document.map_len);
+			}
+#endif
+			break;
 		case NODE_CODE_BLOCK:
 			cmark_chunk_free(&e->as.code.info);
 			cmark_chunk_free(&e->as.code.literal);
@@ -142,6 +331,13 @@ void S_free_nodes(cmark_node *e)
 			cmark_chunk_free(&e->as.link.url);
 			cmark_chunk_free(&e->as.link.title);
 			break;
+		case NODE_TOC:
+			// the TOC and its items keep their levels in user_data
+			CMARK_FREE(e->user_data);
+			for (child = e->first_child; child; child = child->next) {
+				CMARK_FREE(child->user_data);
+			}
+			break;
 		default:
 			break;
 		}
@@ -151,7 +347,7 @@ void S_free_nodes(cmark_node *e)
 			e->next = e->first_child;
 		}
 		next = e->next;
-		free(e);
+		CMARK_FREE(e);
 		e = next;
 	}
 }
@@ -159,9 +355,20 @@ void S_free_nodes(cmark_node *e)
 void
 cmark_node_free(cmark_node *node)
 {
+	cmark_parser_stats *stats = cmark_document_stats(node);
+	uint64_t id = cmark_document_id(node);
+	uint64_t start = cmark_stats_start(stats);
+
+	if (id) {
+		cmark_trace_begin(FREE, id, 0, stats);
+	}
 	S_node_unlink(node);
 	node->next = NULL;
 	S_free_nodes(node);
+	cmark_stats_end(stats, free_ns, start);
+	if (id) {
+		cmark_trace_end(FREE, id, 0, stats);
+	}
 }
 
 cmark_node_type
@@ -181,7 +388,13 @@ cmark_node_get_type_string(cmark_node *node)
 		return "NONE";
 	}
 
-	switch (node->type) {
+	return cmark_node_type_string(node->type);
+}
+
+const char*
+cmark_node_type_string(cmark_node_type type)
+{
+	switch (type) {
 	case CMARK_NODE_NONE:
 		return "none";
 	case CMARK_NODE_DOCUMENT:
@@ -271,6 +484,7 @@ cmark_node_first_child(cmark_node *node)
 	if (node == NULL) {
 		return NULL;
 	} else {
+		cmark_node_ensure_inlines(node);
 		return node->first_child;
 	}
 }
@@ -281,6 +495,7 @@ cmark_node_last_child(cmark_node *node)
 	if (node == NULL) {
 		return NULL;
 	} else {
+		cmark_node_ensure_inlines(node);
 		return node->last_child;
 	}
 }
@@ -319,10 +534,8 @@ cmark_node_get_literal(cmark_node *node)
     case NODE_CODE:
     case NODE_INLINE_LINK:
     case NODE_INCLUDE:
-		return cmark_chunk_to_cstr(&node->as.literal);
-
 	case NODE_CODE_BLOCK:
-		return cmark_chunk_to_cstr(&node->as.code.literal);
+		return cmark_chunk_to_cstr(cmark_node_literal(node));
 
 	default:
 		break;
@@ -345,10 +558,12 @@ cmark_node_set_literal(cmark_node *node, const char *content)
     case NODE_CODE:
     case NODE_INLINE_LINK:
     case NODE_INCLUDE:
+		S_free_slices(node);
 		cmark_chunk_set_cstr(&node->as.literal, content);
 		return 1;
 
 	case NODE_CODE_BLOCK:
+		S_free_slices(node);
 		cmark_chunk_set_cstr(&node->as.code.literal, content);
 		return 1;
 
@@ -629,6 +844,7 @@ cmark_node_get_start_line(cmark_node *node)
 	if (node == NULL) {
 		return 0;
 	}
+	cmark_node_ensure_position(node);
 	return node->start_line;
 }
 
@@ -647,6 +863,7 @@ cmark_node_get_end_line(cmark_node *node)
 	if (node == NULL) {
 		return 0;
 	}
+	cmark_node_ensure_position(node);
 	return node->end_line;
 }
 
@@ -659,6 +876,44 @@ cmark_node_get_end_column(cmark_node *node)
 	return node->end_column;
 }
 
+int
+cmark_node_get_start_offset(cmark_node *node)
+{
+	if (node == NULL) {
+		return 0;
+	}
+	cmark_node_ensure_position(node);
+	return node->start_offset;
+}
+
+int
+cmark_node_get_end_offset(cmark_node *node)
+{
+	if (node == NULL) {
+		return 0;
+	}
+	cmark_node_ensure_position(node);
+	return node->end_offset;
+}
+
+const char*
+cmark_node_get_content(cmark_node *node)
+{
+	if (node == NULL) {
+		return NULL;
+	}
+
+	switch (node->type) {
+	case NODE_PARAGRAPH:
+	case NODE_HEADER:
+		return cmark_strbuf_cstr(&node->string_content);
+	default:
+		break;
+	}
+
+	return NULL;
+}
+
 // Unlink a node without adjusting its next, prev, and parent pointers.
 static void
 S_node_unlink(cmark_node *node)
@@ -686,9 +941,74 @@ S_node_unlink(cmark_node *node)
 	}
 }
 
+static void
+S_own_chunk(cmark_chunk *chunk)
+{
+	if (!chunk->alloc && chunk->len > 0) {
+		cmark_chunk_to_cstr(chunk);
+	}
+}
+
+// Gives the nodes under 'node' copies of strings that point into the
+// document that owns it, before 'node' leaves that document: literals
+// in the retained input or the document's string pool, and inline
+// text sliced from the content of a block.
+static void
+S_copy_document_strings(cmark_node *node)
+{
+	cmark_node *cur = node;
+	cmark_node *root = node->parent;
+
+	if (root == NULL) {
+		return;
+	}
+	while (root->parent) {
+		root = root->parent;
+	}
+	if (root->type != NODE_DOCUMENT) {
+		return;
+	}
+	while (true) {
+		// the inlines cannot be parsed once the references are gone
+		cmark_node_ensure_inlines(cur);
+		switch (cur->type) {
+		case NODE_CODE_BLOCK:
+		case NODE_HTML:
+			S_own_chunk(cmark_node_literal(cur));
+			break;
+		case NODE_TEXT:
+		case NODE_CODE:
+		case NODE_INLINE_HTML:
+		case NODE_INLINE_LINK:
+		case NODE_INCLUDE:
+			S_own_chunk(&cur->as.literal);
+			break;
+		case NODE_LINK:
+		case NODE_IMAGE:
+			S_own_chunk(&cur->as.link.url);
+			S_own_chunk(&cur->as.link.title);
+			break;
+		default:
+			break;
+		}
+		if (cur->first_child) {
+			cur = cur->first_child;
+			continue;
+		}
+		while (cur != node && cur->next == NULL) {
+			cur = cur->parent;
+		}
+		if (cur == node) {
+			break;
+		}
+		cur = cur->next;
+	}
+}
+
 void
 cmark_node_unlink(cmark_node *node)
 {
+	S_copy_document_strings(node);
 	S_node_unlink(node);
 
 	node->next   = NULL;
@@ -708,6 +1028,7 @@ cmark_node_insert_before(cmark_node *node, cmark_node *sibling)
 		return 0;
 	}
 
+	S_copy_document_strings(sibling);
 	S_node_unlink(sibling);
 
 	cmark_node *old_prev = node->prev;
@@ -743,6 +1064,7 @@ cmark_node_insert_after(cmark_node *node, cmark_node *sibling)
 		return 0;
 	}
 
+	S_copy_document_strings(sibling);
 	S_node_unlink(sibling);
 
 	cmark_node *old_next = node->next;
@@ -773,7 +1095,9 @@ cmark_node_prepend_child(cmark_node *node, cmark_node *child)
 	if (!S_can_contain(node, child)) {
 		return 0;
 	}
-    S_node_unlink(child);
+	cmark_node_ensure_inlines(node);
+	S_copy_document_strings(child);
+	S_node_unlink(child);
 
 	cmark_node *old_first_child = node->first_child;
 
@@ -798,7 +1122,9 @@ cmark_node_append_child(cmark_node *node, cmark_node *child)
 	if (!S_can_contain(node, child)) {
 		return 0;
 	}
-    S_node_unlink(child);
+	cmark_node_ensure_inlines(node);
+	S_copy_document_strings(child);
+	S_node_unlink(child);
 
 	cmark_node *old_last_child = node->last_child;
 
@@ -11,6 +11,7 @@ extern "C" {
 #include "cmark.h"
 #include "buffer.h"
 #include "chunk.h"
+#include "pool.h"
 
 typedef struct {
 	cmark_list_type   list_type;
@@ -42,6 +43,58 @@ typedef struct {
 	cmark_chunk title;
 } cmark_link;
 
+// An edit of a cmark_doc that moved the top-level blocks starting at or
+// after 'offset' by 'delta' bytes and 'line_delta' lines.
+typedef struct {
+	int offset;
+	int delta;
+	int line_delta;
+	// some block was moved by it, so it can no longer be extended
+	bool taken;
+} cmark_shift;
+
+// The most shifts a document keeps before applying them all.
+#define CMARK_MAX_SHIFTS 64
+
+typedef struct {
+	// the input, kept when parsed with CMARK_OPT_RETAIN_INPUT ...
+	cmark_strbuf input;
+	// ... unless it is a mapped file, which is kept mapped instead
+	unsigned char *map;
+	size_t map_len;
+	// strings the inlines and link references of the document refer to
+	cmark_pool *pool;
+	// with CMARK_OPT_LAZY_INLINES, what pending inlines are parsed with
+	struct cmark_reference_map *refmap;
+	int options;
+	// the edits of a cmark_doc not yet applied to the positions of
+	// all the blocks they moved; see cmark_node_apply_shifts()
+	int shifts_size;
+	cmark_shift *shifts;
+	cmark_parser_stats *stats;  // not owned; may be NULL
+	struct cmark_governor *governor;  // NULL without limits
+	// for tracing; 0 unless made by a parser with CMARK_TRACE
+	uint64_t id;
+} cmark_document;
+
+static inline const unsigned char *
+cmark_document_input(cmark_document *doc)
+{
+	return doc->map ? doc->map : doc->input.ptr;
+}
+
+// A run of bytes of the document's retained input.
+typedef struct {
+	int offset;
+	int len;
+} cmark_slice;
+
+typedef struct {
+	cmark_slice *items;
+	int size;
+	int asize;
+} cmark_slices;
+
 struct cmark_node {
 	struct cmark_node *next;
 	struct cmark_node *prev;
@@ -56,25 +109,113 @@ struct cmark_node {
 	int end_line;
 	int end_column;
 
+	// byte range of the source lines a block was parsed from
+	int start_offset;
+	int end_offset;
+
 	cmark_node_type type;
 
 	bool open;
 	bool last_line_blank;
+	// a paragraph or header whose inlines are not parsed yet
+	bool pending_inlines;
+	// a block of a cmark_doc, which edits may have moved since its
+	// position was last read
+	bool movable;
+	// of a top-level block of a cmark_doc: how many of the document's
+	// shifts its position includes
+	int shifts_applied;
+	// of a top-level block of a cmark_doc: changes whenever an edit
+	// may have changed its HTML; see cmark_doc_render_html_cached()
+	unsigned int version;
 
 	cmark_strbuf string_content;
 
+	// lines of a code or HTML block that still refer to the
+	// retained input; see cmark_node_literal()
+	cmark_slices *slices;
+
 	union {
 		cmark_chunk       literal;
 		cmark_list        list;
 		cmark_code        code;
 		cmark_header      header;
 		cmark_link        link;
+		cmark_document    document;
 	} as;
 };
 
 CMARK_EXPORT int
 cmark_node_check(cmark_node *node, FILE *out);
 
+// Joins the slices of a code or HTML block into its literal.  A block
+// that is a single slice points into the retained input instead.
+void cmark_node_resolve_literal(cmark_node *node);
+
+// Returns the literal of a node, resolving it first if needed.
+// Renderers must use this for code and HTML blocks.
+static inline cmark_chunk *cmark_node_literal(cmark_node *node)
+{
+	if (node->slices) {
+		cmark_node_resolve_literal(node);
+	}
+	return node->type == CMARK_NODE_CODE_BLOCK ?
+	       &node->as.code.literal : &node->as.literal;
+}
+
+// Parses the inlines of a paragraph or header left pending by
+// CMARK_OPT_LAZY_INLINES.
+void cmark_node_parse_pending_inlines(cmark_node *node);
+
+// Code that reads the children of a node directly must call this
+// first.
+static inline void cmark_node_ensure_inlines(cmark_node *node)
+{
+	if (node->pending_inlines) {
+		cmark_node_parse_pending_inlines(node);
+	}
+}
+
+// Applies to the top-level block of a cmark_doc that contains 'node',
+// and to the blocks in it, the shifts of the edits made since.
+void cmark_node_apply_shifts(cmark_node *node);
+
+// Code that reads the position of a block directly must call this
+// first.
+static inline void cmark_node_ensure_position(cmark_node *node)
+{
+	if (node->movable) {
+		cmark_node_apply_shifts(node);
+	}
+}
+
+// Returns in 'delta' and 'line_delta' how far the shifts of 'root' not
+// yet applied to its top-level block 'block' move it, without applying
+// them.
+void cmark_document_pending_shift(cmark_node *root, cmark_node *block,
+                                  int *delta, int *line_delta);
+
+// Returns the stats that 'node' adds to if it is a document, or NULL.
+static inline cmark_parser_stats *cmark_document_stats(cmark_node *node)
+{
+	return node && node->type == CMARK_NODE_DOCUMENT ?
+	       node->as.document.stats : NULL;
+}
+
+// Returns the governor of 'node' if it is a document with limits, or NULL.
+static inline struct cmark_governor *cmark_document_governor(cmark_node *node)
+{
+	return node && node->type == CMARK_NODE_DOCUMENT ?
+	       node->as.document.governor : NULL;
+}
+
+// Returns the number 'node' is traced with if it is a document, or 0.
+static inline uint64_t cmark_document_id(cmark_node *node)
+{
+	return node && node->type == CMARK_NODE_DOCUMENT ?
+	       node->as.document.id : 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,8 +20,38 @@ struct cmark_parser {
 	int last_line_length;
 	cmark_strbuf *linebuf;
 	int options;
+	// byte offsets in the input of the line being processed
+	// and of the line after it
+	int line_offset;
+	int next_line_offset;
+	// whether curline is an unchanged copy of the input line
+	bool line_verbatim;
+	cmark_parser_stats *stats;  // not owned; may be NULL
+	struct cmark_governor *governor;  // the root's; NULL without limits
+	// the paragraph that takes the input left once a limit stops the parse
+	struct cmark_node *rest;
 };
 
+// Makes a parser whose document has been returned by cmark_parser_finish
+// ready to parse another one, in the same document node.  The document's
+// children are freed and its string pool and the reference map are
+// emptied, keeping the memory they hold, as do the parser's buffers.
+void cmark_parser_reset(cmark_parser *parser);
+
+// Closes all open blocks without parsing inlines.
+void cmark_parser_finish_blocks(cmark_parser *parser);
+
+// (Re)builds the table of contents of a document, if it has one.
+void update_toc(cmark_node *root);
+
+// Parses 'buffer' only until 'max_blocks' top-level blocks are closed,
+// the closed ones span at least 'max_bytes' of input or the open one
+// more than 'max_bytes' (0 meaning no limit).  Sets 'blocks' to the number of leading top-level blocks of
+// the result that are complete.
+cmark_node *cmark_parse_document_head(const char *buffer, size_t len,
+                                      int options, int max_blocks,
+                                      size_t max_bytes, int *blocks);
+
 #ifdef __cplusplus
 }
 #endif
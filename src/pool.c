@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pool.h"
+#include "alloc.h"
+
+#define POOL_MIN_PAGE 4096
+#define POOL_MAX_PAGE (256 * 1024)
+
+cmark_pool *cmark_pool_new(void)
+{
+	cmark_pool *pool = (cmark_pool *)CMARK_CALLOC(OTHER, 1, sizeof(*pool));
+
+	if (pool != NULL) {
+		cmark_strbuf_init(&pool->scratch, 0);
+	}
+	return pool;
+}
+
+void cmark_pool_free(cmark_pool *pool)
+{
+	cmark_pool_page *page, *next;
+
+	if (pool == NULL) {
+		return;
+	}
+	for (page = pool->pages; page; page = next) {
+		next = page->next;
+		CMARK_FREE(page);
+	}
+	cmark_strbuf_free(&pool->scratch);
+	CMARK_FREE(pool);
+}
+
+static cmark_pool_page *S_new_page(size_t size)
+{
+	cmark_pool_page *page =
+	    (cmark_pool_page *)CMARK_MALLOC(CHUNKS, sizeof(*page) + size);
+
+	if (page != NULL) {
+		page->next = NULL;
+		page->size = size;
+		page->used = 0;
+	}
+	return page;
+}
+
+cmark_chunk cmark_pool_put(cmark_pool *pool, const unsigned char *data,
+                           int len)
+{
+	cmark_chunk c = CMARK_CHUNK_EMPTY;
+	cmark_pool_page *page = pool->pages;
+	size_t need = (size_t)len + 1;
+	size_t size;
+
+	if (page == NULL || page->size - page->used < need) {
+		// pages double in size up to a limit; a string that does
+		// not fit in such a page gets a page of its own, behind the
+		// one being filled
+		size = page ? page->size * 2 : POOL_MIN_PAGE;
+		if (size > POOL_MAX_PAGE) {
+			size = POOL_MAX_PAGE;
+		}
+		if (size < need) {
+			size = need;
+		}
+		page = S_new_page(size);
+		if (page == NULL) {
+			return c;
+		}
+		pool->size += size;
+		if (size == need && pool->pages) {
+			page->next = pool->pages->next;
+			pool->pages->next = page;
+		} else {
+			page->next = pool->pages;
+			pool->pages = page;
+		}
+	}
+
+	c.data = page->data + page->used;
+	c.len = len;
+	if (len > 0) {
+		memcpy(c.data, data, len);
+	}
+	c.data[len] = '\0';
+	page->used += need;
+	return c;
+}
+
+void cmark_pool_clear(cmark_pool *pool)
+{
+	cmark_pool_page *page, *next;
+
+	if (pool->pages == NULL) {
+		return;
+	}
+	for (page = pool->pages->next; page; page = next) {
+		next = page->next;
+		CMARK_FREE(page);
+	}
+	pool->pages->next = NULL;
+	pool->pages->used = 0;
+	pool->size = pool->pages->size;
+}
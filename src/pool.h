@@ -0,0 +1,46 @@
+#ifndef CMARK_POOL_H
+#define CMARK_POOL_H
+
+#include <stddef.h>
+
+#include "buffer.h"
+#include "chunk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A string pool owned by a document.  Strings put in the pool never
+// move until the pool is freed, so nodes can refer to them with
+// chunks that do not own their data (alloc == 0).
+
+typedef struct cmark_pool_page {
+	struct cmark_pool_page *next;
+	size_t size;
+	size_t used;
+	unsigned char data[];
+} cmark_pool_page;
+
+typedef struct {
+	cmark_pool_page *pages;  // the page being filled comes first
+	size_t size;             // of all the pages
+	cmark_strbuf scratch;    // for building strings before pooling them
+} cmark_pool;
+
+cmark_pool *cmark_pool_new(void);
+void cmark_pool_free(cmark_pool *pool);
+
+// Copies 'len' bytes of 'data' into the pool and returns a chunk
+// referring to the copy, which is NUL-terminated.
+cmark_chunk cmark_pool_put(cmark_pool *pool, const unsigned char *data,
+                           int len);
+
+// Drops the strings of the pool, keeping the page being filled for the
+// strings put next.
+void cmark_pool_clear(cmark_pool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 #include "utf8.h"
 #include "parser.h"
 #include "references.h"
+#include "alloc.h"
 #include "inlines.h"
 #include "chunk.h"
 
@@ -19,10 +20,10 @@ refhash(const unsigned char *link_ref)
 static void reference_free(cmark_reference *ref)
 {
 	if(ref != NULL) {
-		free(ref->label);
+		CMARK_FREE(ref->label);
 		cmark_chunk_free(&ref->url);
 		cmark_chunk_free(&ref->title);
-		free(ref);
+		CMARK_FREE(ref);
 	}
 }
 
@@ -49,18 +50,48 @@ static unsigned char *normalize_reference(cmark_chunk *ref)
 	assert(result);
 
 	if (result[0] == '\0') {
-		free(result);
+		CMARK_FREE(result);
 		return NULL;
 	}
 
 	return result;
 }
 
+// Doubles the number of buckets, so that buckets stay short however
+// many references a document defines.
+static void grow_table(cmark_reference_map *map)
+{
+	unsigned int size = 2 * map->size;
+	cmark_reference **table;
+	cmark_reference *ref, *next;
+	unsigned int i;
+
+	table = (cmark_reference **)CMARK_CALLOC(REFMAP, size, sizeof(*table));
+	if (table == NULL)
+		return;
+
+	for (i = 0; i < map->size; ++i) {
+		for (ref = map->table[i]; ref; ref = next) {
+			next = ref->next;
+			ref->next = table[ref->hash % size];
+			table[ref->hash % size] = ref;
+		}
+	}
+	CMARK_FREE(map->table);
+	map->table = table;
+	map->size = size;
+}
+
 static void add_reference(cmark_reference_map *map, cmark_reference* ref)
 {
-	cmark_reference *t = ref->next = map->table[ref->hash % REFMAP_SIZE];
+	cmark_reference *t;
+
+	if (map->count >= map->size)
+		grow_table(map);
 
-	while (t) {
+	t = ref->next = map->table[ref->hash % map->size];
+
+	while (t && !map->keep_shadowed) {
 		if (t->hash == ref->hash &&
 		    !strcmp((char *)t->label, (char *)ref->label)) {
 			reference_free(ref);
@@ -70,26 +101,42 @@ static void add_reference(cmark_reference_map *map, cmark_reference* ref)
 		t = t->next;
 	}
 
-	map->table[ref->hash % REFMAP_SIZE] = ref;
+	map->table[ref->hash % map->size] = ref;
+	map->count++;
+}
+
+// Returns true if 'a' was defined before 'b'.
+static bool
+S_defined_before(const cmark_reference *a, const cmark_reference *b)
+{
+	return a->origin < b->origin ||
+	       (a->origin == b->origin && a->seq < b->seq);
 }
 
 void cmark_reference_create(cmark_reference_map *map, cmark_chunk *label, cmark_chunk *url,
                             cmark_chunk *title)
 {
 	cmark_reference *ref;
+	cmark_chunk raw_url, raw_title;
 	unsigned char *reflabel = normalize_reference(label);
 
 	/* empty reference name, or composed from only whitespace */
 	if (reflabel == NULL)
 		return;
 
-	ref = (cmark_reference *)calloc(1, sizeof(*ref));
+	ref = (cmark_reference *)CMARK_CALLOC(REFMAP, 1, sizeof(*ref));
 	if(ref != NULL) {
 		ref->label = reflabel;
 		ref->hash = refhash(ref->label);
-		ref->url = cmark_clean_url(url);
-		ref->title = cmark_clean_title(title);
+		// the definition goes away with its paragraph, so clean
+		// copies in the pool, which links can then share
+		raw_url = cmark_pool_put(map->pool, url->data, url->len);
+		raw_title = cmark_pool_put(map->pool, title->data, title->len);
+		ref->url = cmark_clean_url(map->pool, &raw_url);
+		ref->title = cmark_clean_title(map->pool, &raw_title);
 		ref->next = NULL;
+		ref->origin = map->origin;
+		ref->seq = map->seq++;
 
 		add_reference(map, ref);
 	}
@@ -100,8 +147,10 @@ void cmark_reference_create(cmark_reference_map *map, cmark_chunk *label, cmark_
 cmark_reference* cmark_reference_lookup(cmark_reference_map *map, cmark_chunk *label)
 {
 	cmark_reference *ref = NULL;
+	cmark_reference *found = NULL;
 	unsigned char *norm;
 	unsigned int hash;
+	unsigned int steps = 0;
 
 	if (label->len > MAX_LINK_LABEL_LENGTH)
 		return NULL;
@@ -114,17 +163,28 @@ cmark_reference* cmark_reference_lookup(cmark_reference_map *map, cmark_chunk *l
 		return NULL;
 
 	hash = refhash(norm);
-	ref = map->table[hash % REFMAP_SIZE];
+	ref = map->table[hash % map->size];
 
-	while (ref) {
+	// the first definition of a label wins
+	for (; ref; ref = ref->next) {
+		steps++;
 		if (ref->hash == hash &&
-		    !strcmp((char *)ref->label, (char *)norm))
-			break;
-		ref = ref->next;
+		    !strcmp((char *)ref->label, (char *)norm) &&
+		    (found == NULL || S_defined_before(ref, found))) {
+			found = ref;
+			if (!map->keep_shadowed)
+				break;
+		}
 	}
 
-	free(norm);
-	return ref;
+	if (map->stats) {
+		map->stats->ref_lookups++;
+		map->stats->ref_hits += found != NULL;
+		map->stats->ref_chain_steps += steps;
+	}
+
+	CMARK_FREE(norm);
+	return found;
 }
 
 void cmark_reference_map_free(cmark_reference_map *map)
@@ -134,7 +194,7 @@ void cmark_reference_map_free(cmark_reference_map *map)
 	if(map == NULL)
 		return;
 
-	for (i = 0; i < REFMAP_SIZE; ++i) {
+	for (i = 0; i < map->size; ++i) {
 		cmark_reference *ref = map->table[i];
 		cmark_reference *next;
 
@@ -145,10 +205,141 @@ void cmark_reference_map_free(cmark_reference_map *map)
 		}
 	}
 
-	free(map);
+	CMARK_FREE(map->table);
+	CMARK_FREE(map);
+}
+
+void cmark_reference_map_clear(cmark_reference_map *map)
+{
+	unsigned int i;
+
+	if (map->count > 0) {
+		for (i = 0; i < map->size; ++i) {
+			cmark_reference *ref = map->table[i];
+			cmark_reference *next;
+
+			while (ref) {
+				next = ref->next;
+				reference_free(ref);
+				ref = next;
+			}
+			map->table[i] = NULL;
+		}
+	}
+	map->count = 0;
+	map->origin = 0;
+	map->seq = 0;
 }
 
 cmark_reference_map *cmark_reference_map_new(void)
 {
-	return (cmark_reference_map *)calloc(1, sizeof(cmark_reference_map));
+	cmark_reference_map *map;
+
+	map = (cmark_reference_map *)CMARK_CALLOC(REFMAP, 1,
+	                                          sizeof(cmark_reference_map));
+	if (map == NULL)
+		return NULL;
+
+	map->table = (cmark_reference **)CMARK_CALLOC(REFMAP, REFMAP_SIZE,
+	                                              sizeof(*map->table));
+	if (map->table == NULL) {
+		CMARK_FREE(map);
+		return NULL;
+	}
+	map->size = REFMAP_SIZE;
+	return map;
+}
+
+// Removes the references whose origin lies in [start, end) from 'map'
+// and returns them as a list in definition order.
+cmark_reference *cmark_reference_map_take(cmark_reference_map *map, int start, int end)
+{
+	cmark_reference *taken = NULL;
+	cmark_reference **link;
+	cmark_reference *ref;
+	cmark_reference **pos;
+	unsigned int i;
+
+	for (i = 0; i < map->size; ++i) {
+		link = &map->table[i];
+		while ((ref = *link) != NULL) {
+			if (ref->origin < start || ref->origin >= end) {
+				link = &ref->next;
+				continue;
+			}
+			*link = ref->next;
+			map->count--;
+
+			// insertion sort; such lists are short
+			pos = &taken;
+			while (*pos && S_defined_before(*pos, ref)) {
+				pos = &(*pos)->next;
+			}
+			ref->next = *pos;
+			*pos = ref;
+		}
+	}
+
+	return taken;
+}
+
+// Adds a list of references taken from another map, keeping their origin.
+void cmark_reference_map_insert(cmark_reference_map *map, cmark_reference *list)
+{
+	cmark_reference *next;
+
+	while (list) {
+		next = list->next;
+		add_reference(map, list);
+		list = next;
+	}
+}
+
+// Moves the origin of references defined at or after 'from' by 'delta'.
+void cmark_reference_map_shift(cmark_reference_map *map, int from, int delta)
+{
+	cmark_reference *ref;
+	unsigned int i;
+
+	for (i = 0; i < map->size; ++i) {
+		for (ref = map->table[i]; ref; ref = ref->next) {
+			if (ref->origin >= from) {
+				ref->origin += delta;
+			}
+		}
+	}
+}
+
+static bool
+S_chunk_equal(const cmark_chunk *a, const cmark_chunk *b)
+{
+	return a->len == b->len &&
+	       (a->len == 0 || memcmp(a->data, b->data, a->len) == 0);
+}
+
+// Returns true if both lists define the same labels, in the same
+// order, with the same destinations and titles.
+bool cmark_reference_list_equal(cmark_reference *a, cmark_reference *b)
+{
+	while (a && b) {
+		if (strcmp((char *)a->label, (char *)b->label) ||
+		    !S_chunk_equal(&a->url, &b->url) ||
+		    !S_chunk_equal(&a->title, &b->title)) {
+			return false;
+		}
+		a = a->next;
+		b = b->next;
+	}
+	return a == NULL && b == NULL;
+}
+
+void cmark_reference_list_free(cmark_reference *list)
+{
+	cmark_reference *next;
+
+	while (list) {
+		next = list->next;
+		reference_free(list);
+		list = next;
+	}
 }
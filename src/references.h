@@ -1,12 +1,16 @@
 #ifndef CMARK_REFERENCES_H
 #define CMARK_REFERENCES_H
 
+#include "cmark.h"
 #include "chunk.h"
+#include "pool.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// initial number of buckets; the table doubles whenever it holds
+// more references than buckets
 #define REFMAP_SIZE 16
 
 struct cmark_reference {
@@ -15,21 +19,39 @@ struct cmark_reference {
 	cmark_chunk url;
 	cmark_chunk title;
 	unsigned int hash;
+	int origin;    // offset of the block defining the reference
+	int seq;       // order of definition within that block
 };
 
 typedef struct cmark_reference cmark_reference;
 
 struct cmark_reference_map {
-	cmark_reference *table[REFMAP_SIZE];
+	cmark_reference **table;
+	unsigned int size;   // number of buckets
+	unsigned int count;  // number of references
+	int origin;          // origin given to new references
+	int seq;
+	bool keep_shadowed;  // keep later definitions of a label around
+	cmark_pool *pool;    // holds the urls and titles; not owned
+	cmark_parser_stats *stats;  // not owned; may be NULL
+	struct cmark_governor *governor;  // not owned; may be NULL
 };
 
 typedef struct cmark_reference_map cmark_reference_map;
 
 cmark_reference_map *cmark_reference_map_new(void);
 void cmark_reference_map_free(cmark_reference_map *map);
+// Removes every reference, keeping the table for the next document.
+void cmark_reference_map_clear(cmark_reference_map *map);
 cmark_reference* cmark_reference_lookup(cmark_reference_map *map, cmark_chunk *label);
 extern void cmark_reference_create(cmark_reference_map *map, cmark_chunk *label, cmark_chunk *url, cmark_chunk *title);
 
+cmark_reference *cmark_reference_map_take(cmark_reference_map *map, int start, int end);
+void cmark_reference_map_insert(cmark_reference_map *map, cmark_reference *list);
+void cmark_reference_map_shift(cmark_reference_map *map, int from, int delta);
+bool cmark_reference_list_equal(cmark_reference *a, cmark_reference *b);
+void cmark_reference_list_free(cmark_reference *list);
+
 #ifdef __cplusplus
 }
 #endif
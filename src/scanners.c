@@ -3,23 +3,25 @@
 #include "chunk.h"
 #include "scanners.h"
 
-int _scan_at(int (*scanner)(const unsigned char *), cmark_chunk *c, int offset)
-{
-	int res;
-	unsigned char *ptr = (unsigned char *)c->data;
-	unsigned char lim = ptr[c->len];
-
-	ptr[c->len] = '\0';
-	res = scanner(ptr + offset);
-	ptr[c->len] = lim;
+// The scanners read through YYPEEK, which yields a NUL at the end of
+// the input, so the input needs no terminator and is never written to.
+#define YYPEEK() (p < end ? *p : 0)
+#define YYSKIP() (++p)
+#define YYBACKUP() (marker = p)
+#define YYRESTORE() (p = marker)
+#define YYBACKUPCTX() (marker = p)
+#define YYRESTORECTX() (p = marker)
 
-	return res;
+int _scan_at(int (*scanner)(const unsigned char *, const unsigned char *),
+             cmark_chunk *c, int offset)
+{
+	return scanner(c->data + offset, c->data + c->len);
 }
 
 
 
 // Try to match a scheme including colon.
-int _scan_scheme(const unsigned char *p)
+int _scan_scheme(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -27,7 +29,7 @@ int _scan_scheme(const unsigned char *p)
 {
 	unsigned char yych;
 
-	yych = *p;
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy2;
 	case 'A':
@@ -87,7 +89,9 @@ int _scan_scheme(const unsigned char *p)
 yy2:
 	{ return 0; }
 yy3:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy440;
@@ -104,7 +108,9 @@ yy3:
 	default:	goto yy2;
 	}
 yy4:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy413;
@@ -123,7 +129,9 @@ yy4:
 	default:	goto yy2;
 	}
 yy5:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'M') {
 		if (yych == 'A') goto yy400;
 		if (yych <= 'L') goto yy2;
@@ -138,7 +146,9 @@ yy5:
 		}
 	}
 yy6:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy381;
@@ -161,7 +171,9 @@ yy6:
 	default:	goto yy2;
 	}
 yy7:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'E') {
 			if (yych == 'A') goto yy361;
@@ -188,7 +200,9 @@ yy7:
 		}
 	}
 yy8:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy344;
@@ -203,7 +217,9 @@ yy8:
 	default:	goto yy2;
 	}
 yy9:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= '3') {
 			if (yych <= '2') goto yy2;
@@ -223,7 +239,9 @@ yy9:
 		}
 	}
 yy10:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy317;
@@ -242,7 +260,9 @@ yy10:
 	default:	goto yy2;
 	}
 yy11:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'D') {
 		if (yych == 'A') goto yy305;
 		if (yych <= 'C') goto yy2;
@@ -257,7 +277,9 @@ yy11:
 		}
 	}
 yy12:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy271;
@@ -278,7 +300,9 @@ yy12:
 	default:	goto yy2;
 	}
 yy13:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy261;
@@ -293,7 +317,9 @@ yy13:
 	default:	goto yy2;
 	}
 yy14:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'I') goto yy243;
 		if (yych <= 'O') goto yy2;
@@ -308,7 +334,9 @@ yy14:
 		}
 	}
 yy15:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'L') {
 			if (yych == 'A') goto yy225;
@@ -345,7 +373,9 @@ yy15:
 		}
 	}
 yy16:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'L') {
 			if (yych == 'E') goto yy212;
@@ -369,7 +399,9 @@ yy16:
 		}
 	}
 yy17:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy165;
@@ -400,7 +432,9 @@ yy17:
 	default:	goto yy2;
 	}
 yy18:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy132;
@@ -419,7 +453,9 @@ yy18:
 	default:	goto yy2;
 	}
 yy19:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'N') {
 			if (yych == 'D') goto yy119;
@@ -446,7 +482,9 @@ yy19:
 		}
 	}
 yy20:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'I') {
 		if (yych == 'E') goto yy101;
 		if (yych <= 'H') goto yy2;
@@ -461,7 +499,9 @@ yy20:
 		}
 	}
 yy21:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'Y') {
 		if (yych <= 'R') {
 			if (yych == 'E') goto yy90;
@@ -484,7 +524,9 @@ yy21:
 		}
 	}
 yy22:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych <= 'F') {
 			if (yych == 'C') goto yy67;
@@ -511,11 +553,15 @@ yy22:
 		}
 	}
 yy23:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy59;
 	goto yy2;
 yy24:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych <= 'H') {
 			if (yych == 'E') goto yy49;
@@ -536,170 +582,213 @@ yy24:
 		}
 	}
 yy25:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy45;
 	if (yych == 'd') goto yy45;
 	goto yy2;
 yy26:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy40;
 	if (yych == 'e') goto yy40;
 	goto yy2;
 yy27:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy37;
 	if (yych == 'u') goto yy37;
 	goto yy2;
 yy28:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy30;
 	if (yych == 'm') goto yy30;
 	goto yy2;
 yy29:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy2;
 yy30:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy32;
 	if (yych == 's') goto yy32;
 yy31:
-	p = marker;
+	YYRESTORE ();
 	goto yy2;
 yy32:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy33;
 	if (yych != 'g') goto yy31;
 yy33:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy34;
 	if (yych != 'r') goto yy31;
 yy34:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != ':') goto yy31;
 yy35:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy37:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy38;
 	if (yych != 'e') goto yy31;
 yy38:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy39;
 	if (yych != 'r') goto yy31;
 yy39:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy34;
 	if (yych == 'y') goto yy34;
 	goto yy31;
 yy40:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy41;
 	if (yych != 'y') goto yy31;
 yy41:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy42;
 	if (yych != 'p') goto yy31;
 yy42:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy43;
 	if (yych != 'a') goto yy31;
 yy43:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy44;
 	if (yych != 'r') goto yy31;
 yy44:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy34;
 	if (yych == 'c') goto yy34;
 	goto yy31;
 yy45:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy34;
 	if (yych == 'k') goto yy34;
 	goto yy31;
 yy47:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy58;
 	if (yych == 'l') goto yy58;
 	goto yy31;
 yy48:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy54;
 	if (yych == 't') goto yy54;
 	goto yy31;
 yy49:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy50;
 	if (yych != 's') goto yy31;
 yy50:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy51;
 	if (yych != 'h') goto yy31;
 yy51:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy52;
 	if (yych != 'a') goto yy31;
 yy52:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy53;
 	if (yych != 'r') goto yy31;
 yy53:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy54:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy55;
 	if (yych != 'c') goto yy31;
 yy55:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy56;
 	if (yych != 'o') goto yy31;
 yy56:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy57;
 	if (yych != 'i') goto yy31;
 yy57:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy58:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy59:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '9') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '5') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') goto yy31;
 	if (yych <= 'S') goto yy34;
 	if (yych <= 'q') goto yy31;
 	if (yych <= 's') goto yy34;
 	goto yy31;
 yy64:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy65:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy86;
 	if (yych == 'i') goto yy86;
 	goto yy31;
 yy66:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy76;
 		if (yych <= 'O') goto yy31;
@@ -714,81 +803,100 @@ yy66:
 		}
 	}
 yy67:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy68;
 	if (yych != 'o') goto yy31;
 yy68:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy69;
 	if (yych != 'n') goto yy31;
 yy69:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy70;
 	if (yych == ':') goto yy35;
 	goto yy31;
 yy70:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy71;
 	if (yych != 'u') goto yy31;
 yy71:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy72;
 	if (yych != 's') goto yy31;
 yy72:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy73;
 	if (yych != 'e') goto yy31;
 yy73:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy74;
 	if (yych != 'r') goto yy31;
 yy74:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy75;
 	if (yych != 'i') goto yy31;
 yy75:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy76:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy78;
 	if (yych == 'r') goto yy78;
 	goto yy31;
 yy77:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy78:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy79;
 	if (yych != 'p') goto yy31;
 yy79:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy80;
 	if (yych != 'c') goto yy31;
 yy80:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy82;
 	if (yych != 'b') goto yy31;
 yy82:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy83;
 	if (yych != 'e') goto yy31;
 yy83:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy84;
 	if (yych != 'e') goto yy31;
 yy84:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy85;
 	if (yych != 'p') goto yy31;
 yy85:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -798,31 +906,37 @@ yy85:
 		goto yy31;
 	}
 yy86:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy87;
 	if (yych != 'r') goto yy31;
 yy87:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy88:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy96;
 	if (yych == 'c') goto yy96;
 	goto yy31;
 yy89:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy95;
 	if (yych == 'a') goto yy95;
 	goto yy31;
 yy90:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy92;
 	if (yych == 'b') goto yy92;
 	goto yy31;
 yy91:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -832,47 +946,57 @@ yy91:
 		goto yy31;
 	}
 yy92:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy93;
 	if (yych != 'c') goto yy31;
 yy93:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy94;
 	if (yych != 'a') goto yy31;
 yy94:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy34;
 	if (yych == 'l') goto yy34;
 	goto yy31;
 yy95:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy96:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy97;
 	if (yych != 'i') goto yy31;
 yy97:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy98;
 	if (yych != 'w') goto yy31;
 yy98:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy99;
 	if (yych != 'y') goto yy31;
 yy99:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy34;
 	if (yych == 'g') goto yy34;
 	goto yy31;
 yy100:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy109;
 	if (yych == 'e') goto yy109;
 	goto yy31;
 yy101:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych <= 'L') goto yy31;
 		if (yych >= 'N') goto yy103;
@@ -883,114 +1007,141 @@ yy101:
 		goto yy31;
 	}
 yy102:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy108;
 	if (yych == 'm') goto yy108;
 	goto yy31;
 yy103:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy104;
 	if (yych != 't') goto yy31;
 yy104:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy105;
 	if (yych != 'r') goto yy31;
 yy105:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy106;
 	if (yych != 'i') goto yy31;
 yy106:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy107;
 	if (yych != 'l') goto yy31;
 yy107:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy108:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy109:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy110;
 	if (yych != 'w') goto yy31;
 yy110:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy112;
 	if (yych != 's') goto yy31;
 yy112:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy113;
 	if (yych != 'o') goto yy31;
 yy113:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy114;
 	if (yych != 'u') goto yy31;
 yy114:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy115;
 	if (yych != 'r') goto yy31;
 yy115:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy116;
 	if (yych != 'c') goto yy31;
 yy116:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy117:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '2') goto yy124;
 	goto yy31;
 yy118:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy121;
 	if (yych == 'r') goto yy121;
 	goto yy31;
 yy119:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy120:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy121:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy122;
 	if (yych != 'e') goto yy31;
 yy122:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy123;
 	if (yych != 'a') goto yy31;
 yy123:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy34;
 	if (yych == 'l') goto yy34;
 	goto yy31;
 yy124:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '4') goto yy34;
 	goto yy31;
 yy127:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy146;
 	if (yych == 'i') goto yy146;
 	goto yy31;
 yy128:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'L') {
 		if (yych == 'A') goto yy138;
 		if (yych <= 'K') goto yy31;
@@ -1005,39 +1156,48 @@ yy128:
 		}
 	}
 yy129:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy130:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy134;
 	goto yy31;
 yy131:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy133;
 	if (yych == 't') goto yy133;
 	goto yy31;
 yy132:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy34;
 	if (yych == 'g') goto yy34;
 	goto yy31;
 yy133:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy134:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '7') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '0') goto yy34;
 	goto yy31;
 yy137:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'M') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1047,41 +1207,50 @@ yy137:
 		goto yy31;
 	}
 yy138:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy139;
 	if (yych != 'm') goto yy31;
 yy139:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy140;
 	if (yych != 's') goto yy31;
 yy140:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy141;
 	if (yych != 'p') goto yy31;
 yy141:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy142;
 	if (yych != 'e') goto yy31;
 yy142:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy143;
 	if (yych != 'a') goto yy31;
 yy143:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy34;
 	if (yych == 'k') goto yy34;
 	goto yy31;
 yy144:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy145;
 	if (yych != 'e') goto yy31;
 yy145:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy146:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'N') goto yy147;
 		if (yych <= 'R') goto yy31;
@@ -1095,66 +1264,80 @@ yy146:
 		}
 	}
 yy147:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy155;
 	if (yych == 'g') goto yy155;
 	goto yy31;
 yy148:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy149;
 	if (yych != 'm') goto yy31;
 yy149:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy150;
 	if (yych != 'e') goto yy31;
 yy150:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy151;
 	if (yych != 's') goto yy31;
 yy151:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy152;
 	if (yych != 's') goto yy31;
 yy152:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy153;
 	if (yych != 'a') goto yy31;
 yy153:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy154;
 	if (yych != 'g') goto yy31;
 yy154:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy155:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy156:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy157:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy207;
 	if (yych == 'e') goto yy207;
 	goto yy31;
 yy158:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy34;
 	if (yych == 'h') goto yy34;
 	goto yy31;
 yy159:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy203;
 	if (yych == 'o') goto yy203;
 	goto yy31;
 yy160:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'L') {
 		if (yych == 'A') goto yy193;
 		if (yych <= 'K') goto yy31;
@@ -1169,7 +1352,8 @@ yy160:
 		}
 	}
 yy161:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'B') goto yy34;
 		if (yych <= 'R') goto yy31;
@@ -1184,22 +1368,26 @@ yy161:
 		}
 	}
 yy162:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy191;
 	if (yych == 'y') goto yy191;
 	goto yy31;
 yy163:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy164:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy190;
 	if (yych == 't') goto yy190;
 	goto yy31;
 yy165:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'C') {
 			if (yych <= 'B') goto yy31;
@@ -1220,12 +1408,14 @@ yy165:
 		}
 	}
 yy166:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy174;
 	if (yych == 'm') goto yy174;
 	goto yy31;
 yy167:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'E') goto yy171;
 		if (yych <= 'O') goto yy31;
@@ -1240,25 +1430,30 @@ yy167:
 		}
 	}
 yy168:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy169;
 	if (yych != 't') goto yy31;
 yy169:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy170;
 	if (yych != 't') goto yy31;
 yy170:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy171:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy173;
 	if (yych == 'v') goto yy173;
 	goto yy31;
 yy172:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1268,132 +1463,162 @@ yy172:
 		goto yy31;
 	}
 yy173:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy174:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy175:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy187;
 	if (yych == 'v') goto yy187;
 	goto yy31;
 yy176:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy184;
 	if (yych == 's') goto yy184;
 	goto yy31;
 yy177:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy178;
 	if (yych != 'o') goto yy31;
 yy178:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy179;
 	if (yych != 'n') goto yy31;
 yy179:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy180;
 	if (yych != 'd') goto yy31;
 yy180:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy181;
 	if (yych != 'l') goto yy31;
 yy181:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy182;
 	if (yych != 'i') goto yy31;
 yy182:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy183;
 	if (yych != 'f') goto yy31;
 yy183:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy184:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy185;
 	if (yych != 'i') goto yy31;
 yy185:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy186;
 	if (yych != 'o') goto yy31;
 yy186:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy187:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy188;
 	if (yych != 'i') goto yy31;
 yy188:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy189;
 	if (yych != 'c') goto yy31;
 yy189:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy190:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy191:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy192;
 	if (yych != 'p') goto yy31;
 yy192:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy193:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy197;
 	if (yych == 'p') goto yy197;
 	goto yy31;
 yy194:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy195;
 	if (yych != 'd') goto yy31;
 yy195:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy196;
 	if (yych != 'a') goto yy31;
 yy196:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy197:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy199;
 	if (yych != 'b') goto yy31;
 yy199:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy200;
 	if (yych != 'e') goto yy31;
 yy200:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy201;
 	if (yych != 'e') goto yy31;
 yy201:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy202;
 	if (yych != 'p') goto yy31;
 yy202:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1403,33 +1628,40 @@ yy202:
 		goto yy31;
 	}
 yy203:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy204;
 	if (yych != 't') goto yy31;
 yy204:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy205;
 	if (yych != 'i') goto yy31;
 yy205:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy206;
 	if (yych != 'f') goto yy31;
 yy206:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy34;
 	if (yych == 'y') goto yy34;
 	goto yy31;
 yy207:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy208;
 	if (yych != 'a') goto yy31;
 yy208:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy209:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'M') goto yy221;
 		if (yych <= 'R') goto yy31;
@@ -1444,21 +1676,25 @@ yy209:
 		}
 	}
 yy210:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy218;
 	if (yych == 'y') goto yy218;
 	goto yy31;
 yy211:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy212:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy213;
 	if (yych != 's') goto yy31;
 yy213:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1467,48 +1703,58 @@ yy213:
 		if (yych != 'o') goto yy31;
 	}
 yy214:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy215;
 	if (yych != 'u') goto yy31;
 yy215:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy216;
 	if (yych != 'r') goto yy31;
 yy216:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy217;
 	if (yych != 'c') goto yy31;
 yy217:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy218:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy219;
 	if (yych != 'n') goto yy31;
 yy219:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy34;
 	if (yych == 'c') goto yy34;
 	goto yy31;
 yy220:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy221:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy222:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy242;
 	if (yych == 'y') goto yy242;
 	goto yy31;
 yy223:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'E') goto yy239;
 		if (yych <= 'N') goto yy31;
@@ -1523,12 +1769,14 @@ yy223:
 		}
 	}
 yy224:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy234;
 	if (yych == 'a') goto yy234;
 	goto yy31;
 yy225:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy227;
 		if (yych <= 'O') goto yy31;
@@ -1543,150 +1791,184 @@ yy225:
 		}
 	}
 yy226:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy227:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy228:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy229;
 	if (yych != 'a') goto yy31;
 yy229:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy230;
 	if (yych != 'r') goto yy31;
 yy230:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy231;
 	if (yych != 'a') goto yy31;
 yy231:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy232;
 	if (yych != 'z') goto yy31;
 yy232:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy233;
 	if (yych != 'z') goto yy31;
 yy233:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy234:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy235;
 	if (yych != 't') goto yy31;
 yy235:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy236;
 	if (yych != 'f') goto yy31;
 yy236:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy237;
 	if (yych != 'o') goto yy31;
 yy237:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy238;
 	if (yych != 'r') goto yy31;
 yy238:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy239:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy240:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy241;
 	if (yych != 'x') goto yy31;
 yy241:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy34;
 	if (yych == 'y') goto yy34;
 	goto yy31;
 yy242:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy34;
 	if (yych == 'c') goto yy34;
 	goto yy31;
 yy243:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy244:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy245;
 	if (yych != 'a') goto yy31;
 yy245:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy246;
 	if (yych != 'q') goto yy31;
 yy246:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy247;
 	if (yych != 'u') goto yy31;
 yy247:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy248;
 	if (yych != 'e') goto yy31;
 yy248:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy249;
 	if (yych != 'l') goto yy31;
 yy249:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy250;
 	if (yych != 'o') goto yy31;
 yy250:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy251;
 	if (yych != 'c') goto yy31;
 yy251:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy252;
 	if (yych != 'k') goto yy31;
 yy252:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy253;
 	if (yych != 't') goto yy31;
 yy253:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy254;
 	if (yych != 'o') goto yy31;
 yy254:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy255;
 	if (yych != 'k') goto yy31;
 yy255:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy256;
 	if (yych != 'e') goto yy31;
 yy256:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy257:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy264;
 	if (yych == 't') goto yy264;
 	goto yy31;
 yy258:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy263;
 	if (yych == 't') goto yy263;
 	goto yy31;
 yy259:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'G') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1696,40 +1978,48 @@ yy259:
 		goto yy31;
 	}
 yy260:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy261:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy262;
 	if (yych != 'w') goto yy31;
 yy262:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy263:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy264:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy265;
 	if (yych != 'e') goto yy31;
 yy265:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy266:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy267:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'M') goto yy298;
 		if (yych <= 'O') goto yy31;
@@ -1744,7 +2034,8 @@ yy267:
 		}
 	}
 yy268:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') {
 		if (yych <= '-') {
 			if (yych <= ',') goto yy31;
@@ -1764,17 +2055,20 @@ yy268:
 		}
 	}
 yy269:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy270:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy285;
 	if (yych == 's') goto yy285;
 	goto yy31;
 yy271:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy276;
@@ -1787,117 +2081,142 @@ yy271:
 	default:	goto yy31;
 	}
 yy272:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy274;
 	if (yych == 'q') goto yy274;
 	goto yy31;
 yy273:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy274:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy275:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy283;
 	if (yych == 'l') goto yy283;
 	goto yy31;
 yy276:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy281;
 	if (yych == 'n') goto yy281;
 	goto yy31;
 yy277:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy278:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy279;
 	if (yych != 'k') goto yy31;
 yy279:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy280;
 	if (yych != 'e') goto yy31;
 yy280:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy281:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy282;
 	if (yych != 'e') goto yy31;
 yy282:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy283:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy284;
 	if (yych != 't') goto yy31;
 yy284:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy285:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy286;
 	if (yych != 's') goto yy31;
 yy286:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy287;
 	if (yych != 'a') goto yy31;
 yy287:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy288;
 	if (yych != 'g') goto yy31;
 yy288:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy289:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy296;
 	if (yych == 'p') goto yy296;
 	goto yy31;
 yy290:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy293;
 	if (yych == 'h') goto yy293;
 	goto yy31;
 yy291:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy292;
 	if (yych != 'i') goto yy31;
 yy292:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy293:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy294;
 	if (yych != 'e') goto yy31;
 yy294:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy295;
 	if (yych != 'l') goto yy31;
 yy295:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy296:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1907,64 +2226,78 @@ yy296:
 		goto yy31;
 	}
 yy297:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy301;
 	if (yych == 'd') goto yy301;
 	goto yy31;
 yy298:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy299;
 	if (yych != 'b') goto yy31;
 yy299:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy300;
 	if (yych != 'l') goto yy31;
 yy300:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy301:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy302;
 	if (yych != 'a') goto yy31;
 yy302:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy303;
 	if (yych != 't') goto yy31;
 yy303:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy304:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy309;
 	if (yych == 'a') goto yy309;
 	goto yy31;
 yy305:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy306;
 	if (yych != 's') goto yy31;
 yy306:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy307;
 	if (yych != 't') goto yy31;
 yy307:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy308;
 	if (yych != 'f') goto yy31;
 yy308:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy309:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy310;
 	if (yych != 'p') goto yy31;
 yy310:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -1974,12 +2307,14 @@ yy310:
 		goto yy31;
 	}
 yy311:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy334;
 	if (yych == 'm') goto yy334;
 	goto yy31;
 yy312:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'I') {
 		if (yych == 'C') goto yy323;
 		if (yych <= 'H') goto yy31;
@@ -1994,7 +2329,8 @@ yy312:
 		}
 	}
 yy313:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'N') goto yy34;
 		if (yych <= 'O') goto yy31;
@@ -2009,7 +2345,8 @@ yy313:
 		}
 	}
 yy314:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'A') goto yy320;
 		if (yych <= 'N') goto yy31;
@@ -2024,12 +2361,14 @@ yy314:
 		}
 	}
 yy315:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy319;
 	if (yych == 'f') goto yy319;
 	goto yy31;
 yy316:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -2039,37 +2378,44 @@ yy316:
 		goto yy31;
 	}
 yy317:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy34;
 	if (yych == 'x') goto yy34;
 	goto yy31;
 yy318:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy319:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy320:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy321:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy322:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy324;
 	if (yych == 's') goto yy324;
 	goto yy31;
 yy323:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ':') {
 		if (yych == '6') goto yy34;
 		if (yych <= '9') goto yy31;
@@ -2084,12 +2430,14 @@ yy323:
 		}
 	}
 yy324:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '.') goto yy325;
 	if (yych == ':') goto yy35;
 	goto yy31;
 yy325:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'X') {
 		if (yych <= 'K') {
 			if (yych == 'B') goto yy328;
@@ -2110,34 +2458,41 @@ yy325:
 		}
 	}
 yy326:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy333;
 	if (yych == 'w') goto yy333;
 	goto yy31;
 yy327:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy331;
 	if (yych == 'p') goto yy331;
 	goto yy31;
 yy328:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy329;
 	if (yych != 'e') goto yy31;
 yy329:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy330;
 	if (yych != 'e') goto yy31;
 yy330:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy331:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy332;
 	if (yych != 'c') goto yy31;
 yy332:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -2147,37 +2502,45 @@ yy332:
 		goto yy31;
 	}
 yy333:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy34;
 	if (yych == 'z') goto yy34;
 	goto yy31;
 yy334:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy335:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy336:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy339;
 	if (yych == 't') goto yy339;
 	goto yy31;
 yy337:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy34;
 	goto yy31;
 yy339:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy340;
 	if (yych != 'p') goto yy31;
 yy340:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -2187,12 +2550,14 @@ yy340:
 		goto yy31;
 	}
 yy341:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy357;
 	if (yych == 'a') goto yy357;
 	goto yy31;
 yy342:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Z') {
 		if (yych == 'T') goto yy34;
 		if (yych <= 'Y') goto yy31;
@@ -2207,7 +2572,8 @@ yy342:
 		}
 	}
 yy343:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -2217,71 +2583,87 @@ yy343:
 		goto yy31;
 	}
 yy344:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy345:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy346;
 	if (yych != 'h') goto yy31;
 yy346:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy347;
 	if (yych != 'e') goto yy31;
 yy347:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy34;
 	if (yych == 'r') goto yy34;
 	goto yy31;
 yy348:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy349;
 	if (yych != 'm') goto yy31;
 yy349:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy350;
 	if (yych != 'o') goto yy31;
 yy350:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy351;
 	if (yych != 'p') goto yy31;
 yy351:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy352;
 	if (yych != 'r') goto yy31;
 yy352:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy353;
 	if (yych != 'o') goto yy31;
 yy353:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'J') goto yy354;
 	if (yych != 'j') goto yy31;
 yy354:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy355;
 	if (yych != 'e') goto yy31;
 yy355:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy356;
 	if (yych != 'c') goto yy31;
 yy356:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy357:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy358;
 	if (yych != 'l') goto yy31;
 yy358:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy34;
 	if (yych == 'k') goto yy34;
 	goto yy31;
 yy359:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'M') {
 			if (yych == 'L') goto yy369;
@@ -2302,87 +2684,105 @@ yy359:
 		}
 	}
 yy360:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy368;
 	if (yych == 'e') goto yy368;
 	goto yy31;
 yy361:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy363;
 	if (yych == 'c') goto yy363;
 	goto yy31;
 yy362:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy363:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy364;
 	if (yych != 'e') goto yy31;
 yy364:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy365;
 	if (yych != 't') goto yy31;
 yy365:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy366;
 	if (yych != 'i') goto yy31;
 yy366:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy367;
 	if (yych != 'm') goto yy31;
 yy367:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy368:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy369:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy370:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy372;
 	if (yych == 'g') goto yy372;
 	goto yy31;
 yy371:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy34;
 	if (yych == 'h') goto yy34;
 	goto yy31;
 yy372:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy373;
 	if (yych != 'e') goto yy31;
 yy373:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy34;
 	if (yych == 'r') goto yy34;
 	goto yy31;
 yy374:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy392;
 	if (yych == 't') goto yy392;
 	goto yy31;
 yy375:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy376:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy34;
 	if (yych == 'm') goto yy34;
 	goto yy31;
 yy377:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'P') goto yy34;
 		if (yych <= 'R') goto yy31;
@@ -2397,26 +2797,31 @@ yy377:
 		}
 	}
 yy378:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy386;
 	if (yych == 'i') goto yy386;
 	goto yy31;
 yy379:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy385;
 	if (yych == 'a') goto yy385;
 	goto yy31;
 yy380:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy383;
 	if (yych == 'o') goto yy383;
 	goto yy31;
 yy381:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy382;
 	if (yych != 'a') goto yy31;
 yy382:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy35;
 		goto yy31;
@@ -2426,80 +2831,98 @@ yy382:
 		goto yy31;
 	}
 yy383:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy384;
 	if (yych != 'u') goto yy31;
 yy384:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy385:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy386:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy387;
 	if (yych != 'u') goto yy31;
 yy387:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy388;
 	if (yych != 'm') goto yy31;
 yy388:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy389;
 	if (yych != 'x') goto yy31;
 yy389:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy390;
 	if (yych != 't') goto yy31;
 yy390:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy391;
 	if (yych != 'r') goto yy31;
 yy391:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy34;
 	if (yych == 'a') goto yy34;
 	goto yy31;
 yy392:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy393;
 	if (yych != 'a') goto yy31;
 yy393:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy394;
 	if (yych != 'c') goto yy31;
 yy394:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy395;
 	if (yych != 'h') goto yy31;
 yy395:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy396;
 	if (yych != 'm') goto yy31;
 yy396:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy397;
 	if (yych != 'e') goto yy31;
 yy397:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy398;
 	if (yych != 'n') goto yy31;
 yy398:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy399:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy400:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'V') {
 		if (yych == 'R') goto yy34;
 		if (yych <= 'U') goto yy31;
@@ -2511,61 +2934,74 @@ yy400:
 			if (yych != 'v') goto yy31;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy402;
 	if (yych != 'a') goto yy31;
 yy402:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy403;
 	if (yych != 's') goto yy31;
 yy403:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy404;
 	if (yych != 'c') goto yy31;
 yy404:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy405;
 	if (yych != 'r') goto yy31;
 yy405:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy406;
 	if (yych != 'i') goto yy31;
 yy406:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy407;
 	if (yych != 'p') goto yy31;
 yy407:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy408:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy34;
 	if (yych == 'b') goto yy34;
 	goto yy31;
 yy409:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy410:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy417;
 	if (yych == 'n') goto yy417;
 	goto yy31;
 yy411:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy412:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy416;
 	if (yych == 'c') goto yy416;
 	goto yy31;
 yy413:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'V') {
 		if (yych == 'T') goto yy415;
 		if (yych <= 'U') goto yy31;
@@ -2580,44 +3016,54 @@ yy413:
 		}
 	}
 yy414:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy34;
 	if (yych == 'i') goto yy34;
 	goto yy31;
 yy415:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy34;
 	if (yych == 'a') goto yy34;
 	goto yy31;
 yy416:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy417:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy418;
 	if (yych != 'a') goto yy31;
 yy418:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy420;
 	if (yych != 'p') goto yy31;
 yy420:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy421;
 	if (yych != 'l') goto yy31;
 yy421:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy422;
 	if (yych != 'a') goto yy31;
 yy422:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy423;
 	if (yych != 'y') goto yy31;
 yy423:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'C') goto yy424;
 		if (yych <= 'R') goto yy31;
@@ -2631,67 +3077,82 @@ yy423:
 		}
 	}
 yy424:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy430;
 	if (yych == 'o') goto yy430;
 	goto yy31;
 yy425:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy426;
 	if (yych != 'i') goto yy31;
 yy426:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy427;
 	if (yych != 'n') goto yy31;
 yy427:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy428;
 	if (yych != 'g') goto yy31;
 yy428:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy429;
 	if (yych != 'l') goto yy31;
 yy429:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 yy430:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy431;
 	if (yych != 'n') goto yy31;
 yy431:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy432;
 	if (yych != 't') goto yy31;
 yy432:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy433;
 	if (yych != 'a') goto yy31;
 yy433:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy434;
 	if (yych != 'i') goto yy31;
 yy434:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy435;
 	if (yych != 'n') goto yy31;
 yy435:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy436;
 	if (yych != 'e') goto yy31;
 yy436:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy34;
 	if (yych == 'r') goto yy34;
 	goto yy31;
 yy437:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy34;
 	if (yych == 's') goto yy34;
 	goto yy31;
 yy438:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych <= 'A') {
 			if (yych <= '@') goto yy31;
@@ -2712,12 +3173,14 @@ yy438:
 		}
 	}
 yy439:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy447;
 	if (yych == 'r') goto yy447;
 	goto yy31;
 yy440:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy444;
 		if (yych <= 'O') goto yy31;
@@ -2732,186 +3195,229 @@ yy440:
 		}
 	}
 yy441:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy443;
 	if (yych == 'i') goto yy443;
 	goto yy31;
 yy442:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy443:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy34;
 	if (yych == 'd') goto yy34;
 	goto yy31;
 yy444:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy445;
 	if (yych != 'l') goto yy31;
 yy445:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy446;
 	if (yych != 't') goto yy31;
 yy446:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy34;
 	if (yych == 'o') goto yy34;
 	goto yy31;
 yy447:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy448;
 	if (yych != 'o') goto yy31;
 yy448:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy449;
 	if (yych != 'm') goto yy31;
 yy449:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy450;
 	if (yych != 'e') goto yy31;
 yy450:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy451;
 	if (yych == ':') goto yy35;
 	goto yy31;
 yy451:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy452;
 	if (yych != 'e') goto yy31;
 yy452:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy453;
 	if (yych != 'x') goto yy31;
 yy453:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy454;
 	if (yych != 't') goto yy31;
 yy454:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy455;
 	if (yych != 'e') goto yy31;
 yy455:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy456;
 	if (yych != 'n') goto yy31;
 yy456:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy457;
 	if (yych != 's') goto yy31;
 yy457:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy458;
 	if (yych != 'i') goto yy31;
 yy458:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy459;
 	if (yych != 'o') goto yy31;
 yy459:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy34;
 	if (yych == 'n') goto yy34;
 	goto yy31;
 yy460:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy34;
 	if (yych == 'p') goto yy34;
 	goto yy31;
 yy461:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy466;
 	goto yy31;
 yy462:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy463;
 	if (yych != 't') goto yy31;
 yy463:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy464;
 	if (yych != 'e') goto yy31;
 yy464:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy465;
 	if (yych != 'n') goto yy31;
 yy465:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy34;
 	if (yych == 't') goto yy34;
 	goto yy31;
 yy466:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy467;
 	if (yych != 'e') goto yy31;
 yy467:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy468;
 	if (yych != 'v') goto yy31;
 yy468:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy469;
 	if (yych != 'e') goto yy31;
 yy469:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy470;
 	if (yych != 'n') goto yy31;
 yy470:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy471;
 	if (yych != 't') goto yy31;
 yy471:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy472;
 	if (yych != 'b') goto yy31;
 yy472:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy473;
 	if (yych != 'r') goto yy31;
 yy473:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy474;
 	if (yych != 'i') goto yy31;
 yy474:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy475;
 	if (yych != 't') goto yy31;
 yy475:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy476;
 	if (yych != 'e') goto yy31;
 yy476:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy31;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy478;
 	if (yych != 'a') goto yy31;
 yy478:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy479;
 	if (yych != 't') goto yy31;
 yy479:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy480;
 	if (yych != 't') goto yy31;
 yy480:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy481;
 	if (yych != 'e') goto yy31;
 yy481:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy482;
 	if (yych != 'n') goto yy31;
 yy482:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy483;
 	if (yych != 'd') goto yy31;
 yy483:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy484;
 	if (yych != 'e') goto yy31;
 yy484:
-	++p;
-	if ((yych = *p) == 'E') goto yy34;
+	YYSKIP ();
+	if ((yych = YYPEEK ()) == 'E') goto yy34;
 	if (yych == 'e') goto yy34;
 	goto yy31;
 }
@@ -2919,7 +3425,7 @@ yy484:
 }
 
 // Try to match URI autolink after first <, returning number of chars matched.
-int _scan_autolink_uri(const unsigned char *p)
+int _scan_autolink_uri(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -2960,7 +3466,7 @@ int _scan_autolink_uri(const unsigned char *p)
 		128, 128, 128, 128, 128, 128, 128, 128, 
 		128, 128, 128, 128, 128, 128, 128, 128, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy487;
 	case 'A':
@@ -3020,7 +3526,9 @@ int _scan_autolink_uri(const unsigned char *p)
 yy487:
 	{ return 0; }
 yy488:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy927;
@@ -3037,7 +3545,9 @@ yy488:
 	default:	goto yy487;
 	}
 yy489:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy900;
@@ -3056,7 +3566,9 @@ yy489:
 	default:	goto yy487;
 	}
 yy490:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'M') {
 		if (yych == 'A') goto yy887;
 		if (yych <= 'L') goto yy487;
@@ -3071,7 +3583,9 @@ yy490:
 		}
 	}
 yy491:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy868;
@@ -3094,7 +3608,9 @@ yy491:
 	default:	goto yy487;
 	}
 yy492:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'E') {
 			if (yych == 'A') goto yy848;
@@ -3121,7 +3637,9 @@ yy492:
 		}
 	}
 yy493:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy831;
@@ -3136,7 +3654,9 @@ yy493:
 	default:	goto yy487;
 	}
 yy494:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= '3') {
 			if (yych <= '2') goto yy487;
@@ -3156,7 +3676,9 @@ yy494:
 		}
 	}
 yy495:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy804;
@@ -3175,7 +3697,9 @@ yy495:
 	default:	goto yy487;
 	}
 yy496:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'D') {
 		if (yych == 'A') goto yy792;
 		if (yych <= 'C') goto yy487;
@@ -3190,7 +3714,9 @@ yy496:
 		}
 	}
 yy497:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy758;
@@ -3211,7 +3737,9 @@ yy497:
 	default:	goto yy487;
 	}
 yy498:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy748;
@@ -3226,7 +3754,9 @@ yy498:
 	default:	goto yy487;
 	}
 yy499:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'I') goto yy730;
 		if (yych <= 'O') goto yy487;
@@ -3241,7 +3771,9 @@ yy499:
 		}
 	}
 yy500:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'L') {
 			if (yych == 'A') goto yy712;
@@ -3278,7 +3810,9 @@ yy500:
 		}
 	}
 yy501:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'L') {
 			if (yych == 'E') goto yy699;
@@ -3302,7 +3836,9 @@ yy501:
 		}
 	}
 yy502:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy652;
@@ -3333,7 +3869,9 @@ yy502:
 	default:	goto yy487;
 	}
 yy503:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy619;
@@ -3352,7 +3890,9 @@ yy503:
 	default:	goto yy487;
 	}
 yy504:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'N') {
 			if (yych == 'D') goto yy606;
@@ -3379,7 +3919,9 @@ yy504:
 		}
 	}
 yy505:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'I') {
 		if (yych == 'E') goto yy588;
 		if (yych <= 'H') goto yy487;
@@ -3394,7 +3936,9 @@ yy505:
 		}
 	}
 yy506:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'Y') {
 		if (yych <= 'R') {
 			if (yych == 'E') goto yy577;
@@ -3417,7 +3961,9 @@ yy506:
 		}
 	}
 yy507:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych <= 'F') {
 			if (yych == 'C') goto yy554;
@@ -3444,11 +3990,15 @@ yy507:
 		}
 	}
 yy508:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy546;
 	goto yy487;
 yy509:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych <= 'H') {
 			if (yych == 'E') goto yy536;
@@ -3469,176 +4019,219 @@ yy509:
 		}
 	}
 yy510:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy532;
 	if (yych == 'd') goto yy532;
 	goto yy487;
 yy511:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy527;
 	if (yych == 'e') goto yy527;
 	goto yy487;
 yy512:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy524;
 	if (yych == 'u') goto yy524;
 	goto yy487;
 yy513:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy515;
 	if (yych == 'm') goto yy515;
 	goto yy487;
 yy514:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy487;
 yy515:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy517;
 	if (yych == 's') goto yy517;
 yy516:
-	p = marker;
+	YYRESTORE ();
 	goto yy487;
 yy517:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy518;
 	if (yych != 'g') goto yy516;
 yy518:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy519;
 	if (yych != 'r') goto yy516;
 yy519:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != ':') goto yy516;
 yy520:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy520;
 	}
 	if (yych <= '<') goto yy516;
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy524:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy525;
 	if (yych != 'e') goto yy516;
 yy525:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy526;
 	if (yych != 'r') goto yy516;
 yy526:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy519;
 	if (yych == 'y') goto yy519;
 	goto yy516;
 yy527:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy528;
 	if (yych != 'y') goto yy516;
 yy528:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy529;
 	if (yych != 'p') goto yy516;
 yy529:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy530;
 	if (yych != 'a') goto yy516;
 yy530:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy531;
 	if (yych != 'r') goto yy516;
 yy531:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy519;
 	if (yych == 'c') goto yy519;
 	goto yy516;
 yy532:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy519;
 	if (yych == 'k') goto yy519;
 	goto yy516;
 yy534:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy545;
 	if (yych == 'l') goto yy545;
 	goto yy516;
 yy535:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy541;
 	if (yych == 't') goto yy541;
 	goto yy516;
 yy536:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy537;
 	if (yych != 's') goto yy516;
 yy537:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy538;
 	if (yych != 'h') goto yy516;
 yy538:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy539;
 	if (yych != 'a') goto yy516;
 yy539:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy540;
 	if (yych != 'r') goto yy516;
 yy540:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy541:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy542;
 	if (yych != 'c') goto yy516;
 yy542:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy543;
 	if (yych != 'o') goto yy516;
 yy543:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy544;
 	if (yych != 'i') goto yy516;
 yy544:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy545:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy546:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '9') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '5') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') goto yy516;
 	if (yych <= 'S') goto yy519;
 	if (yych <= 'q') goto yy516;
 	if (yych <= 's') goto yy519;
 	goto yy516;
 yy551:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy552:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy573;
 	if (yych == 'i') goto yy573;
 	goto yy516;
 yy553:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy563;
 		if (yych <= 'O') goto yy516;
@@ -3653,81 +4246,100 @@ yy553:
 		}
 	}
 yy554:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy555;
 	if (yych != 'o') goto yy516;
 yy555:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy556;
 	if (yych != 'n') goto yy516;
 yy556:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy557;
 	if (yych == ':') goto yy520;
 	goto yy516;
 yy557:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy558;
 	if (yych != 'u') goto yy516;
 yy558:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy559;
 	if (yych != 's') goto yy516;
 yy559:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy560;
 	if (yych != 'e') goto yy516;
 yy560:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy561;
 	if (yych != 'r') goto yy516;
 yy561:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy562;
 	if (yych != 'i') goto yy516;
 yy562:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy563:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy565;
 	if (yych == 'r') goto yy565;
 	goto yy516;
 yy564:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy565:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy566;
 	if (yych != 'p') goto yy516;
 yy566:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy567;
 	if (yych != 'c') goto yy516;
 yy567:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy569;
 	if (yych != 'b') goto yy516;
 yy569:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy570;
 	if (yych != 'e') goto yy516;
 yy570:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy571;
 	if (yych != 'e') goto yy516;
 yy571:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy572;
 	if (yych != 'p') goto yy516;
 yy572:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -3737,31 +4349,37 @@ yy572:
 		goto yy516;
 	}
 yy573:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy574;
 	if (yych != 'r') goto yy516;
 yy574:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy575:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy583;
 	if (yych == 'c') goto yy583;
 	goto yy516;
 yy576:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy582;
 	if (yych == 'a') goto yy582;
 	goto yy516;
 yy577:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy579;
 	if (yych == 'b') goto yy579;
 	goto yy516;
 yy578:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -3771,47 +4389,57 @@ yy578:
 		goto yy516;
 	}
 yy579:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy580;
 	if (yych != 'c') goto yy516;
 yy580:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy581;
 	if (yych != 'a') goto yy516;
 yy581:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy519;
 	if (yych == 'l') goto yy519;
 	goto yy516;
 yy582:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy583:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy584;
 	if (yych != 'i') goto yy516;
 yy584:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy585;
 	if (yych != 'w') goto yy516;
 yy585:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy586;
 	if (yych != 'y') goto yy516;
 yy586:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy519;
 	if (yych == 'g') goto yy519;
 	goto yy516;
 yy587:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy596;
 	if (yych == 'e') goto yy596;
 	goto yy516;
 yy588:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych <= 'L') goto yy516;
 		if (yych >= 'N') goto yy590;
@@ -3822,114 +4450,141 @@ yy588:
 		goto yy516;
 	}
 yy589:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy595;
 	if (yych == 'm') goto yy595;
 	goto yy516;
 yy590:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy591;
 	if (yych != 't') goto yy516;
 yy591:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy592;
 	if (yych != 'r') goto yy516;
 yy592:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy593;
 	if (yych != 'i') goto yy516;
 yy593:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy594;
 	if (yych != 'l') goto yy516;
 yy594:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy595:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy596:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy597;
 	if (yych != 'w') goto yy516;
 yy597:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy599;
 	if (yych != 's') goto yy516;
 yy599:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy600;
 	if (yych != 'o') goto yy516;
 yy600:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy601;
 	if (yych != 'u') goto yy516;
 yy601:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy602;
 	if (yych != 'r') goto yy516;
 yy602:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy603;
 	if (yych != 'c') goto yy516;
 yy603:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy604:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '2') goto yy611;
 	goto yy516;
 yy605:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy608;
 	if (yych == 'r') goto yy608;
 	goto yy516;
 yy606:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy607:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy608:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy609;
 	if (yych != 'e') goto yy516;
 yy609:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy610;
 	if (yych != 'a') goto yy516;
 yy610:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy519;
 	if (yych == 'l') goto yy519;
 	goto yy516;
 yy611:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '0') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '4') goto yy519;
 	goto yy516;
 yy614:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy633;
 	if (yych == 'i') goto yy633;
 	goto yy516;
 yy615:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'L') {
 		if (yych == 'A') goto yy625;
 		if (yych <= 'K') goto yy516;
@@ -3944,39 +4599,48 @@ yy615:
 		}
 	}
 yy616:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy617:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy621;
 	goto yy516;
 yy618:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy620;
 	if (yych == 't') goto yy620;
 	goto yy516;
 yy619:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy519;
 	if (yych == 'g') goto yy519;
 	goto yy516;
 yy620:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy621:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '7') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '0') goto yy519;
 	goto yy516;
 yy624:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'M') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -3986,41 +4650,50 @@ yy624:
 		goto yy516;
 	}
 yy625:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy626;
 	if (yych != 'm') goto yy516;
 yy626:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy627;
 	if (yych != 's') goto yy516;
 yy627:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy628;
 	if (yych != 'p') goto yy516;
 yy628:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy629;
 	if (yych != 'e') goto yy516;
 yy629:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy630;
 	if (yych != 'a') goto yy516;
 yy630:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy519;
 	if (yych == 'k') goto yy519;
 	goto yy516;
 yy631:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy632;
 	if (yych != 'e') goto yy516;
 yy632:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy633:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'N') goto yy634;
 		if (yych <= 'R') goto yy516;
@@ -4034,66 +4707,80 @@ yy633:
 		}
 	}
 yy634:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy642;
 	if (yych == 'g') goto yy642;
 	goto yy516;
 yy635:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy636;
 	if (yych != 'm') goto yy516;
 yy636:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy637;
 	if (yych != 'e') goto yy516;
 yy637:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy638;
 	if (yych != 's') goto yy516;
 yy638:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy639;
 	if (yych != 's') goto yy516;
 yy639:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy640;
 	if (yych != 'a') goto yy516;
 yy640:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy641;
 	if (yych != 'g') goto yy516;
 yy641:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy642:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy643:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy644:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy694;
 	if (yych == 'e') goto yy694;
 	goto yy516;
 yy645:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy519;
 	if (yych == 'h') goto yy519;
 	goto yy516;
 yy646:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy690;
 	if (yych == 'o') goto yy690;
 	goto yy516;
 yy647:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'L') {
 		if (yych == 'A') goto yy680;
 		if (yych <= 'K') goto yy516;
@@ -4108,7 +4795,8 @@ yy647:
 		}
 	}
 yy648:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'B') goto yy519;
 		if (yych <= 'R') goto yy516;
@@ -4123,22 +4811,26 @@ yy648:
 		}
 	}
 yy649:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy678;
 	if (yych == 'y') goto yy678;
 	goto yy516;
 yy650:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy651:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy677;
 	if (yych == 't') goto yy677;
 	goto yy516;
 yy652:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'C') {
 			if (yych <= 'B') goto yy516;
@@ -4159,12 +4851,14 @@ yy652:
 		}
 	}
 yy653:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy661;
 	if (yych == 'm') goto yy661;
 	goto yy516;
 yy654:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'E') goto yy658;
 		if (yych <= 'O') goto yy516;
@@ -4179,25 +4873,30 @@ yy654:
 		}
 	}
 yy655:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy656;
 	if (yych != 't') goto yy516;
 yy656:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy657;
 	if (yych != 't') goto yy516;
 yy657:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy658:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy660;
 	if (yych == 'v') goto yy660;
 	goto yy516;
 yy659:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4207,132 +4906,162 @@ yy659:
 		goto yy516;
 	}
 yy660:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy661:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy662:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy674;
 	if (yych == 'v') goto yy674;
 	goto yy516;
 yy663:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy671;
 	if (yych == 's') goto yy671;
 	goto yy516;
 yy664:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy665;
 	if (yych != 'o') goto yy516;
 yy665:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy666;
 	if (yych != 'n') goto yy516;
 yy666:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy667;
 	if (yych != 'd') goto yy516;
 yy667:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy668;
 	if (yych != 'l') goto yy516;
 yy668:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy669;
 	if (yych != 'i') goto yy516;
 yy669:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy670;
 	if (yych != 'f') goto yy516;
 yy670:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy671:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy672;
 	if (yych != 'i') goto yy516;
 yy672:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy673;
 	if (yych != 'o') goto yy516;
 yy673:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy674:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy675;
 	if (yych != 'i') goto yy516;
 yy675:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy676;
 	if (yych != 'c') goto yy516;
 yy676:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy677:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy678:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy679;
 	if (yych != 'p') goto yy516;
 yy679:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy680:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy684;
 	if (yych == 'p') goto yy684;
 	goto yy516;
 yy681:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy682;
 	if (yych != 'd') goto yy516;
 yy682:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy683;
 	if (yych != 'a') goto yy516;
 yy683:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy684:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '.') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy686;
 	if (yych != 'b') goto yy516;
 yy686:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy687;
 	if (yych != 'e') goto yy516;
 yy687:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy688;
 	if (yych != 'e') goto yy516;
 yy688:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy689;
 	if (yych != 'p') goto yy516;
 yy689:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4342,33 +5071,40 @@ yy689:
 		goto yy516;
 	}
 yy690:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy691;
 	if (yych != 't') goto yy516;
 yy691:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy692;
 	if (yych != 'i') goto yy516;
 yy692:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy693;
 	if (yych != 'f') goto yy516;
 yy693:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy519;
 	if (yych == 'y') goto yy519;
 	goto yy516;
 yy694:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy695;
 	if (yych != 'a') goto yy516;
 yy695:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy696:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'M') goto yy708;
 		if (yych <= 'R') goto yy516;
@@ -4383,21 +5119,25 @@ yy696:
 		}
 	}
 yy697:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy705;
 	if (yych == 'y') goto yy705;
 	goto yy516;
 yy698:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy699:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy700;
 	if (yych != 's') goto yy516;
 yy700:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4406,48 +5146,58 @@ yy700:
 		if (yych != 'o') goto yy516;
 	}
 yy701:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy702;
 	if (yych != 'u') goto yy516;
 yy702:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy703;
 	if (yych != 'r') goto yy516;
 yy703:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy704;
 	if (yych != 'c') goto yy516;
 yy704:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy705:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy706;
 	if (yych != 'n') goto yy516;
 yy706:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy519;
 	if (yych == 'c') goto yy519;
 	goto yy516;
 yy707:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy708:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy709:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy729;
 	if (yych == 'y') goto yy729;
 	goto yy516;
 yy710:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'E') goto yy726;
 		if (yych <= 'N') goto yy516;
@@ -4462,12 +5212,14 @@ yy710:
 		}
 	}
 yy711:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy721;
 	if (yych == 'a') goto yy721;
 	goto yy516;
 yy712:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy714;
 		if (yych <= 'O') goto yy516;
@@ -4482,150 +5234,184 @@ yy712:
 		}
 	}
 yy713:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy714:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy715:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy716;
 	if (yych != 'a') goto yy516;
 yy716:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy717;
 	if (yych != 'r') goto yy516;
 yy717:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy718;
 	if (yych != 'a') goto yy516;
 yy718:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy719;
 	if (yych != 'z') goto yy516;
 yy719:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy720;
 	if (yych != 'z') goto yy516;
 yy720:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy721:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy722;
 	if (yych != 't') goto yy516;
 yy722:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy723;
 	if (yych != 'f') goto yy516;
 yy723:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy724;
 	if (yych != 'o') goto yy516;
 yy724:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy725;
 	if (yych != 'r') goto yy516;
 yy725:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy726:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy727:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy728;
 	if (yych != 'x') goto yy516;
 yy728:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy519;
 	if (yych == 'y') goto yy519;
 	goto yy516;
 yy729:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy519;
 	if (yych == 'c') goto yy519;
 	goto yy516;
 yy730:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy731:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy732;
 	if (yych != 'a') goto yy516;
 yy732:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy733;
 	if (yych != 'q') goto yy516;
 yy733:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy734;
 	if (yych != 'u') goto yy516;
 yy734:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy735;
 	if (yych != 'e') goto yy516;
 yy735:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy736;
 	if (yych != 'l') goto yy516;
 yy736:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy737;
 	if (yych != 'o') goto yy516;
 yy737:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy738;
 	if (yych != 'c') goto yy516;
 yy738:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy739;
 	if (yych != 'k') goto yy516;
 yy739:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy740;
 	if (yych != 't') goto yy516;
 yy740:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy741;
 	if (yych != 'o') goto yy516;
 yy741:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy742;
 	if (yych != 'k') goto yy516;
 yy742:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy743;
 	if (yych != 'e') goto yy516;
 yy743:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy744:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy751;
 	if (yych == 't') goto yy751;
 	goto yy516;
 yy745:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy750;
 	if (yych == 't') goto yy750;
 	goto yy516;
 yy746:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'G') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4635,40 +5421,48 @@ yy746:
 		goto yy516;
 	}
 yy747:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy748:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy749;
 	if (yych != 'w') goto yy516;
 yy749:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy750:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy751:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy752;
 	if (yych != 'e') goto yy516;
 yy752:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy753:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy754:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'M') goto yy785;
 		if (yych <= 'O') goto yy516;
@@ -4683,7 +5477,8 @@ yy754:
 		}
 	}
 yy755:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') {
 		if (yych <= '-') {
 			if (yych <= ',') goto yy516;
@@ -4703,17 +5498,20 @@ yy755:
 		}
 	}
 yy756:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy757:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy772;
 	if (yych == 's') goto yy772;
 	goto yy516;
 yy758:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy763;
@@ -4726,117 +5524,142 @@ yy758:
 	default:	goto yy516;
 	}
 yy759:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy761;
 	if (yych == 'q') goto yy761;
 	goto yy516;
 yy760:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy761:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy762:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy770;
 	if (yych == 'l') goto yy770;
 	goto yy516;
 yy763:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy768;
 	if (yych == 'n') goto yy768;
 	goto yy516;
 yy764:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy765:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy766;
 	if (yych != 'k') goto yy516;
 yy766:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy767;
 	if (yych != 'e') goto yy516;
 yy767:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy768:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy769;
 	if (yych != 'e') goto yy516;
 yy769:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy770:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy771;
 	if (yych != 't') goto yy516;
 yy771:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy772:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy773;
 	if (yych != 's') goto yy516;
 yy773:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy774;
 	if (yych != 'a') goto yy516;
 yy774:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy775;
 	if (yych != 'g') goto yy516;
 yy775:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy776:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy783;
 	if (yych == 'p') goto yy783;
 	goto yy516;
 yy777:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy780;
 	if (yych == 'h') goto yy780;
 	goto yy516;
 yy778:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy779;
 	if (yych != 'i') goto yy516;
 yy779:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy780:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy781;
 	if (yych != 'e') goto yy516;
 yy781:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy782;
 	if (yych != 'l') goto yy516;
 yy782:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy783:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4846,64 +5669,78 @@ yy783:
 		goto yy516;
 	}
 yy784:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy788;
 	if (yych == 'd') goto yy788;
 	goto yy516;
 yy785:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy786;
 	if (yych != 'b') goto yy516;
 yy786:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy787;
 	if (yych != 'l') goto yy516;
 yy787:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy788:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy789;
 	if (yych != 'a') goto yy516;
 yy789:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy790;
 	if (yych != 't') goto yy516;
 yy790:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy791:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy796;
 	if (yych == 'a') goto yy796;
 	goto yy516;
 yy792:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy793;
 	if (yych != 's') goto yy516;
 yy793:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy794;
 	if (yych != 't') goto yy516;
 yy794:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy795;
 	if (yych != 'f') goto yy516;
 yy795:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy796:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy797;
 	if (yych != 'p') goto yy516;
 yy797:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4913,12 +5750,14 @@ yy797:
 		goto yy516;
 	}
 yy798:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy821;
 	if (yych == 'm') goto yy821;
 	goto yy516;
 yy799:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'I') {
 		if (yych == 'C') goto yy810;
 		if (yych <= 'H') goto yy516;
@@ -4933,7 +5772,8 @@ yy799:
 		}
 	}
 yy800:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'N') goto yy519;
 		if (yych <= 'O') goto yy516;
@@ -4948,7 +5788,8 @@ yy800:
 		}
 	}
 yy801:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'A') goto yy807;
 		if (yych <= 'N') goto yy516;
@@ -4963,12 +5804,14 @@ yy801:
 		}
 	}
 yy802:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy806;
 	if (yych == 'f') goto yy806;
 	goto yy516;
 yy803:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -4978,37 +5821,44 @@ yy803:
 		goto yy516;
 	}
 yy804:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy519;
 	if (yych == 'x') goto yy519;
 	goto yy516;
 yy805:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy806:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy807:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy808:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy809:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy811;
 	if (yych == 's') goto yy811;
 	goto yy516;
 yy810:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ':') {
 		if (yych == '6') goto yy519;
 		if (yych <= '9') goto yy516;
@@ -5023,12 +5873,14 @@ yy810:
 		}
 	}
 yy811:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '.') goto yy812;
 	if (yych == ':') goto yy520;
 	goto yy516;
 yy812:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'X') {
 		if (yych <= 'K') {
 			if (yych == 'B') goto yy815;
@@ -5049,34 +5901,41 @@ yy812:
 		}
 	}
 yy813:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'W') goto yy820;
 	if (yych == 'w') goto yy820;
 	goto yy516;
 yy814:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy818;
 	if (yych == 'p') goto yy818;
 	goto yy516;
 yy815:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy816;
 	if (yych != 'e') goto yy516;
 yy816:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy817;
 	if (yych != 'e') goto yy516;
 yy817:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy818:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy819;
 	if (yych != 'c') goto yy516;
 yy819:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -5086,37 +5945,45 @@ yy819:
 		goto yy516;
 	}
 yy820:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Z') goto yy519;
 	if (yych == 'z') goto yy519;
 	goto yy516;
 yy821:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy822:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy823:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy826;
 	if (yych == 't') goto yy826;
 	goto yy516;
 yy824:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '2') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '3') goto yy519;
 	goto yy516;
 yy826:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy827;
 	if (yych != 'p') goto yy516;
 yy827:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -5126,12 +5993,14 @@ yy827:
 		goto yy516;
 	}
 yy828:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy844;
 	if (yych == 'a') goto yy844;
 	goto yy516;
 yy829:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Z') {
 		if (yych == 'T') goto yy519;
 		if (yych <= 'Y') goto yy516;
@@ -5146,7 +6015,8 @@ yy829:
 		}
 	}
 yy830:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -5156,71 +6026,87 @@ yy830:
 		goto yy516;
 	}
 yy831:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy832:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy833;
 	if (yych != 'h') goto yy516;
 yy833:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy834;
 	if (yych != 'e') goto yy516;
 yy834:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy519;
 	if (yych == 'r') goto yy519;
 	goto yy516;
 yy835:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy836;
 	if (yych != 'm') goto yy516;
 yy836:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy837;
 	if (yych != 'o') goto yy516;
 yy837:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy838;
 	if (yych != 'p') goto yy516;
 yy838:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy839;
 	if (yych != 'r') goto yy516;
 yy839:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy840;
 	if (yych != 'o') goto yy516;
 yy840:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'J') goto yy841;
 	if (yych != 'j') goto yy516;
 yy841:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy842;
 	if (yych != 'e') goto yy516;
 yy842:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy843;
 	if (yych != 'c') goto yy516;
 yy843:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy844:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy845;
 	if (yych != 'l') goto yy516;
 yy845:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy519;
 	if (yych == 'k') goto yy519;
 	goto yy516;
 yy846:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'M') {
 			if (yych == 'L') goto yy856;
@@ -5241,87 +6127,105 @@ yy846:
 		}
 	}
 yy847:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy855;
 	if (yych == 'e') goto yy855;
 	goto yy516;
 yy848:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy850;
 	if (yych == 'c') goto yy850;
 	goto yy516;
 yy849:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy850:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy851;
 	if (yych != 'e') goto yy516;
 yy851:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy852;
 	if (yych != 't') goto yy516;
 yy852:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy853;
 	if (yych != 'i') goto yy516;
 yy853:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy854;
 	if (yych != 'm') goto yy516;
 yy854:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy855:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy856:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy857:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy859;
 	if (yych == 'g') goto yy859;
 	goto yy516;
 yy858:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy519;
 	if (yych == 'h') goto yy519;
 	goto yy516;
 yy859:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy860;
 	if (yych != 'e') goto yy516;
 yy860:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy519;
 	if (yych == 'r') goto yy519;
 	goto yy516;
 yy861:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy879;
 	if (yych == 't') goto yy879;
 	goto yy516;
 yy862:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy863:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy519;
 	if (yych == 'm') goto yy519;
 	goto yy516;
 yy864:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'P') goto yy519;
 		if (yych <= 'R') goto yy516;
@@ -5336,26 +6240,31 @@ yy864:
 		}
 	}
 yy865:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy873;
 	if (yych == 'i') goto yy873;
 	goto yy516;
 yy866:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy872;
 	if (yych == 'a') goto yy872;
 	goto yy516;
 yy867:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy870;
 	if (yych == 'o') goto yy870;
 	goto yy516;
 yy868:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy869;
 	if (yych != 'a') goto yy516;
 yy869:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == ':') goto yy520;
 		goto yy516;
@@ -5365,80 +6274,98 @@ yy869:
 		goto yy516;
 	}
 yy870:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy871;
 	if (yych != 'u') goto yy516;
 yy871:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy872:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy873:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy874;
 	if (yych != 'u') goto yy516;
 yy874:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy875;
 	if (yych != 'm') goto yy516;
 yy875:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy876;
 	if (yych != 'x') goto yy516;
 yy876:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy877;
 	if (yych != 't') goto yy516;
 yy877:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy878;
 	if (yych != 'r') goto yy516;
 yy878:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy519;
 	if (yych == 'a') goto yy519;
 	goto yy516;
 yy879:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy880;
 	if (yych != 'a') goto yy516;
 yy880:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy881;
 	if (yych != 'c') goto yy516;
 yy881:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'H') goto yy882;
 	if (yych != 'h') goto yy516;
 yy882:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy883;
 	if (yych != 'm') goto yy516;
 yy883:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy884;
 	if (yych != 'e') goto yy516;
 yy884:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy885;
 	if (yych != 'n') goto yy516;
 yy885:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy886:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy887:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'V') {
 		if (yych == 'R') goto yy519;
 		if (yych <= 'U') goto yy516;
@@ -5450,61 +6377,74 @@ yy887:
 			if (yych != 'v') goto yy516;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy889;
 	if (yych != 'a') goto yy516;
 yy889:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy890;
 	if (yych != 's') goto yy516;
 yy890:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy891;
 	if (yych != 'c') goto yy516;
 yy891:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy892;
 	if (yych != 'r') goto yy516;
 yy892:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy893;
 	if (yych != 'i') goto yy516;
 yy893:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy894;
 	if (yych != 'p') goto yy516;
 yy894:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy895:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy519;
 	if (yych == 'b') goto yy519;
 	goto yy516;
 yy896:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy897:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy904;
 	if (yych == 'n') goto yy904;
 	goto yy516;
 yy898:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy899:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy903;
 	if (yych == 'c') goto yy903;
 	goto yy516;
 yy900:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'V') {
 		if (yych == 'T') goto yy902;
 		if (yych <= 'U') goto yy516;
@@ -5519,44 +6459,54 @@ yy900:
 		}
 	}
 yy901:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy519;
 	if (yych == 'i') goto yy519;
 	goto yy516;
 yy902:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy519;
 	if (yych == 'a') goto yy519;
 	goto yy516;
 yy903:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy904:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy905;
 	if (yych != 'a') goto yy516;
 yy905:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy907;
 	if (yych != 'p') goto yy516;
 yy907:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy908;
 	if (yych != 'l') goto yy516;
 yy908:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy909;
 	if (yych != 'a') goto yy516;
 yy909:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy910;
 	if (yych != 'y') goto yy516;
 yy910:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych == 'C') goto yy911;
 		if (yych <= 'R') goto yy516;
@@ -5570,67 +6520,82 @@ yy910:
 		}
 	}
 yy911:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy917;
 	if (yych == 'o') goto yy917;
 	goto yy516;
 yy912:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy913;
 	if (yych != 'i') goto yy516;
 yy913:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy914;
 	if (yych != 'n') goto yy516;
 yy914:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy915;
 	if (yych != 'g') goto yy516;
 yy915:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy916;
 	if (yych != 'l') goto yy516;
 yy916:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 yy917:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy918;
 	if (yych != 'n') goto yy516;
 yy918:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy919;
 	if (yych != 't') goto yy516;
 yy919:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy920;
 	if (yych != 'a') goto yy516;
 yy920:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy921;
 	if (yych != 'i') goto yy516;
 yy921:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy922;
 	if (yych != 'n') goto yy516;
 yy922:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy923;
 	if (yych != 'e') goto yy516;
 yy923:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy519;
 	if (yych == 'r') goto yy519;
 	goto yy516;
 yy924:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy519;
 	if (yych == 's') goto yy519;
 	goto yy516;
 yy925:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'N') {
 		if (yych <= 'A') {
 			if (yych <= '@') goto yy516;
@@ -5651,12 +6616,14 @@ yy925:
 		}
 	}
 yy926:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy934;
 	if (yych == 'r') goto yy934;
 	goto yy516;
 yy927:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'L') goto yy931;
 		if (yych <= 'O') goto yy516;
@@ -5671,186 +6638,229 @@ yy927:
 		}
 	}
 yy928:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy930;
 	if (yych == 'i') goto yy930;
 	goto yy516;
 yy929:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy930:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy519;
 	if (yych == 'd') goto yy519;
 	goto yy516;
 yy931:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy932;
 	if (yych != 'l') goto yy516;
 yy932:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy933;
 	if (yych != 't') goto yy516;
 yy933:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy519;
 	if (yych == 'o') goto yy519;
 	goto yy516;
 yy934:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy935;
 	if (yych != 'o') goto yy516;
 yy935:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy936;
 	if (yych != 'm') goto yy516;
 yy936:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy937;
 	if (yych != 'e') goto yy516;
 yy937:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy938;
 	if (yych == ':') goto yy520;
 	goto yy516;
 yy938:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy939;
 	if (yych != 'e') goto yy516;
 yy939:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy940;
 	if (yych != 'x') goto yy516;
 yy940:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy941;
 	if (yych != 't') goto yy516;
 yy941:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy942;
 	if (yych != 'e') goto yy516;
 yy942:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy943;
 	if (yych != 'n') goto yy516;
 yy943:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy944;
 	if (yych != 's') goto yy516;
 yy944:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy945;
 	if (yych != 'i') goto yy516;
 yy945:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy946;
 	if (yych != 'o') goto yy516;
 yy946:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy519;
 	if (yych == 'n') goto yy519;
 	goto yy516;
 yy947:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy519;
 	if (yych == 'p') goto yy519;
 	goto yy516;
 yy948:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy953;
 	goto yy516;
 yy949:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy950;
 	if (yych != 't') goto yy516;
 yy950:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy951;
 	if (yych != 'e') goto yy516;
 yy951:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy952;
 	if (yych != 'n') goto yy516;
 yy952:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy519;
 	if (yych == 't') goto yy519;
 	goto yy516;
 yy953:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy954;
 	if (yych != 'e') goto yy516;
 yy954:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy955;
 	if (yych != 'v') goto yy516;
 yy955:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy956;
 	if (yych != 'e') goto yy516;
 yy956:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy957;
 	if (yych != 'n') goto yy516;
 yy957:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy958;
 	if (yych != 't') goto yy516;
 yy958:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy959;
 	if (yych != 'b') goto yy516;
 yy959:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy960;
 	if (yych != 'r') goto yy516;
 yy960:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy961;
 	if (yych != 'i') goto yy516;
 yy961:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy962;
 	if (yych != 't') goto yy516;
 yy962:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy963;
 	if (yych != 'e') goto yy516;
 yy963:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy516;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy965;
 	if (yych != 'a') goto yy516;
 yy965:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy966;
 	if (yych != 't') goto yy516;
 yy966:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy967;
 	if (yych != 't') goto yy516;
 yy967:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy968;
 	if (yych != 'e') goto yy516;
 yy968:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy969;
 	if (yych != 'n') goto yy516;
 yy969:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy970;
 	if (yych != 'd') goto yy516;
 yy970:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy971;
 	if (yych != 'e') goto yy516;
 yy971:
-	++p;
-	if ((yych = *p) == 'E') goto yy519;
+	YYSKIP ();
+	if ((yych = YYPEEK ()) == 'E') goto yy519;
 	if (yych == 'e') goto yy519;
 	goto yy516;
 }
@@ -5858,7 +6868,7 @@ yy971:
 }
 
 // Try to match email autolink after first <, returning num of chars matched.
-int _scan_autolink_email(const unsigned char *p)
+int _scan_autolink_email(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -5899,7 +6909,7 @@ int _scan_autolink_email(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= ',') {
 		if (yych <= '!') {
 			if (yych == '\n') goto yy974;
@@ -5938,7 +6948,9 @@ int _scan_autolink_email(const unsigned char *p)
 yy974:
 	{ return 0; }
 yy975:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= ',') {
 		if (yych <= '"') {
 			if (yych == '!') goto yy980;
@@ -5962,10 +6974,12 @@ yy975:
 		}
 	}
 yy976:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy974;
 yy977:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy978;
 		if (yych <= '9') goto yy981;
@@ -5975,11 +6989,11 @@ yy977:
 		if (yych <= 'z') goto yy981;
 	}
 yy978:
-	p = marker;
+	YYRESTORE ();
 	goto yy974;
 yy979:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy980:
 	if (yybm[0+yych] & 128) {
 		goto yy979;
@@ -5988,7 +7002,8 @@ yy980:
 	if (yych <= '@') goto yy977;
 	goto yy978;
 yy981:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6009,7 +7024,8 @@ yy981:
 			goto yy978;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1111;
 		if (yych <= '/') goto yy978;
@@ -6025,7 +7041,8 @@ yy981:
 		}
 	}
 yy983:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6047,8 +7064,8 @@ yy983:
 		}
 	}
 yy984:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy978;
 		if (yych <= '9') goto yy987;
@@ -6060,11 +7077,11 @@ yy984:
 		goto yy978;
 	}
 yy985:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy987:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6085,8 +7102,8 @@ yy987:
 			goto yy978;
 		}
 	}
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy990;
 		if (yych <= '/') goto yy978;
@@ -6102,8 +7119,8 @@ yy987:
 		}
 	}
 yy989:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6125,8 +7142,8 @@ yy989:
 		}
 	}
 yy990:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy992;
 		if (yych <= '/') goto yy978;
@@ -6142,8 +7159,8 @@ yy990:
 		}
 	}
 yy991:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6165,8 +7182,8 @@ yy991:
 		}
 	}
 yy992:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy994;
 		if (yych <= '/') goto yy978;
@@ -6182,8 +7199,8 @@ yy992:
 		}
 	}
 yy993:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6205,8 +7222,8 @@ yy993:
 		}
 	}
 yy994:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy996;
 		if (yych <= '/') goto yy978;
@@ -6222,8 +7239,8 @@ yy994:
 		}
 	}
 yy995:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6245,8 +7262,8 @@ yy995:
 		}
 	}
 yy996:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy998;
 		if (yych <= '/') goto yy978;
@@ -6262,8 +7279,8 @@ yy996:
 		}
 	}
 yy997:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6285,8 +7302,8 @@ yy997:
 		}
 	}
 yy998:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1000;
 		if (yych <= '/') goto yy978;
@@ -6302,8 +7319,8 @@ yy998:
 		}
 	}
 yy999:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6325,8 +7342,8 @@ yy999:
 		}
 	}
 yy1000:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1002;
 		if (yych <= '/') goto yy978;
@@ -6342,8 +7359,8 @@ yy1000:
 		}
 	}
 yy1001:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6365,8 +7382,8 @@ yy1001:
 		}
 	}
 yy1002:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1004;
 		if (yych <= '/') goto yy978;
@@ -6382,8 +7399,8 @@ yy1002:
 		}
 	}
 yy1003:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6405,8 +7422,8 @@ yy1003:
 		}
 	}
 yy1004:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1006;
 		if (yych <= '/') goto yy978;
@@ -6422,8 +7439,8 @@ yy1004:
 		}
 	}
 yy1005:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6445,8 +7462,8 @@ yy1005:
 		}
 	}
 yy1006:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1008;
 		if (yych <= '/') goto yy978;
@@ -6462,8 +7479,8 @@ yy1006:
 		}
 	}
 yy1007:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6485,8 +7502,8 @@ yy1007:
 		}
 	}
 yy1008:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1010;
 		if (yych <= '/') goto yy978;
@@ -6502,8 +7519,8 @@ yy1008:
 		}
 	}
 yy1009:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6525,8 +7542,8 @@ yy1009:
 		}
 	}
 yy1010:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1012;
 		if (yych <= '/') goto yy978;
@@ -6542,8 +7559,8 @@ yy1010:
 		}
 	}
 yy1011:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6565,8 +7582,8 @@ yy1011:
 		}
 	}
 yy1012:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1014;
 		if (yych <= '/') goto yy978;
@@ -6582,8 +7599,8 @@ yy1012:
 		}
 	}
 yy1013:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6605,8 +7622,8 @@ yy1013:
 		}
 	}
 yy1014:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1016;
 		if (yych <= '/') goto yy978;
@@ -6622,8 +7639,8 @@ yy1014:
 		}
 	}
 yy1015:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6645,8 +7662,8 @@ yy1015:
 		}
 	}
 yy1016:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1018;
 		if (yych <= '/') goto yy978;
@@ -6662,8 +7679,8 @@ yy1016:
 		}
 	}
 yy1017:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6685,8 +7702,8 @@ yy1017:
 		}
 	}
 yy1018:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1020;
 		if (yych <= '/') goto yy978;
@@ -6702,8 +7719,8 @@ yy1018:
 		}
 	}
 yy1019:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6725,8 +7742,8 @@ yy1019:
 		}
 	}
 yy1020:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1022;
 		if (yych <= '/') goto yy978;
@@ -6742,8 +7759,8 @@ yy1020:
 		}
 	}
 yy1021:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6765,8 +7782,8 @@ yy1021:
 		}
 	}
 yy1022:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1024;
 		if (yych <= '/') goto yy978;
@@ -6782,8 +7799,8 @@ yy1022:
 		}
 	}
 yy1023:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6805,8 +7822,8 @@ yy1023:
 		}
 	}
 yy1024:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1026;
 		if (yych <= '/') goto yy978;
@@ -6822,8 +7839,8 @@ yy1024:
 		}
 	}
 yy1025:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6845,8 +7862,8 @@ yy1025:
 		}
 	}
 yy1026:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1028;
 		if (yych <= '/') goto yy978;
@@ -6862,8 +7879,8 @@ yy1026:
 		}
 	}
 yy1027:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6885,8 +7902,8 @@ yy1027:
 		}
 	}
 yy1028:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1030;
 		if (yych <= '/') goto yy978;
@@ -6902,8 +7919,8 @@ yy1028:
 		}
 	}
 yy1029:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6925,8 +7942,8 @@ yy1029:
 		}
 	}
 yy1030:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1032;
 		if (yych <= '/') goto yy978;
@@ -6942,8 +7959,8 @@ yy1030:
 		}
 	}
 yy1031:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -6965,8 +7982,8 @@ yy1031:
 		}
 	}
 yy1032:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1034;
 		if (yych <= '/') goto yy978;
@@ -6982,8 +7999,8 @@ yy1032:
 		}
 	}
 yy1033:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7005,8 +8022,8 @@ yy1033:
 		}
 	}
 yy1034:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1036;
 		if (yych <= '/') goto yy978;
@@ -7022,8 +8039,8 @@ yy1034:
 		}
 	}
 yy1035:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7045,8 +8062,8 @@ yy1035:
 		}
 	}
 yy1036:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1038;
 		if (yych <= '/') goto yy978;
@@ -7062,8 +8079,8 @@ yy1036:
 		}
 	}
 yy1037:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7085,8 +8102,8 @@ yy1037:
 		}
 	}
 yy1038:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1040;
 		if (yych <= '/') goto yy978;
@@ -7102,8 +8119,8 @@ yy1038:
 		}
 	}
 yy1039:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7125,8 +8142,8 @@ yy1039:
 		}
 	}
 yy1040:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1042;
 		if (yych <= '/') goto yy978;
@@ -7142,8 +8159,8 @@ yy1040:
 		}
 	}
 yy1041:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7165,8 +8182,8 @@ yy1041:
 		}
 	}
 yy1042:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1044;
 		if (yych <= '/') goto yy978;
@@ -7182,8 +8199,8 @@ yy1042:
 		}
 	}
 yy1043:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7205,8 +8222,8 @@ yy1043:
 		}
 	}
 yy1044:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1046;
 		if (yych <= '/') goto yy978;
@@ -7222,8 +8239,8 @@ yy1044:
 		}
 	}
 yy1045:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7245,8 +8262,8 @@ yy1045:
 		}
 	}
 yy1046:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1048;
 		if (yych <= '/') goto yy978;
@@ -7262,8 +8279,8 @@ yy1046:
 		}
 	}
 yy1047:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7285,8 +8302,8 @@ yy1047:
 		}
 	}
 yy1048:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1050;
 		if (yych <= '/') goto yy978;
@@ -7302,8 +8319,8 @@ yy1048:
 		}
 	}
 yy1049:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7325,8 +8342,8 @@ yy1049:
 		}
 	}
 yy1050:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1052;
 		if (yych <= '/') goto yy978;
@@ -7342,8 +8359,8 @@ yy1050:
 		}
 	}
 yy1051:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7365,8 +8382,8 @@ yy1051:
 		}
 	}
 yy1052:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1054;
 		if (yych <= '/') goto yy978;
@@ -7382,8 +8399,8 @@ yy1052:
 		}
 	}
 yy1053:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7405,8 +8422,8 @@ yy1053:
 		}
 	}
 yy1054:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1056;
 		if (yych <= '/') goto yy978;
@@ -7422,8 +8439,8 @@ yy1054:
 		}
 	}
 yy1055:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7445,8 +8462,8 @@ yy1055:
 		}
 	}
 yy1056:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1058;
 		if (yych <= '/') goto yy978;
@@ -7462,8 +8479,8 @@ yy1056:
 		}
 	}
 yy1057:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7485,8 +8502,8 @@ yy1057:
 		}
 	}
 yy1058:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1060;
 		if (yych <= '/') goto yy978;
@@ -7502,8 +8519,8 @@ yy1058:
 		}
 	}
 yy1059:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7525,8 +8542,8 @@ yy1059:
 		}
 	}
 yy1060:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1062;
 		if (yych <= '/') goto yy978;
@@ -7542,8 +8559,8 @@ yy1060:
 		}
 	}
 yy1061:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7565,8 +8582,8 @@ yy1061:
 		}
 	}
 yy1062:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1064;
 		if (yych <= '/') goto yy978;
@@ -7582,8 +8599,8 @@ yy1062:
 		}
 	}
 yy1063:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7605,8 +8622,8 @@ yy1063:
 		}
 	}
 yy1064:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1066;
 		if (yych <= '/') goto yy978;
@@ -7622,8 +8639,8 @@ yy1064:
 		}
 	}
 yy1065:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7645,8 +8662,8 @@ yy1065:
 		}
 	}
 yy1066:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1068;
 		if (yych <= '/') goto yy978;
@@ -7662,8 +8679,8 @@ yy1066:
 		}
 	}
 yy1067:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7685,8 +8702,8 @@ yy1067:
 		}
 	}
 yy1068:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1070;
 		if (yych <= '/') goto yy978;
@@ -7702,8 +8719,8 @@ yy1068:
 		}
 	}
 yy1069:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7725,8 +8742,8 @@ yy1069:
 		}
 	}
 yy1070:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1072;
 		if (yych <= '/') goto yy978;
@@ -7742,8 +8759,8 @@ yy1070:
 		}
 	}
 yy1071:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7765,8 +8782,8 @@ yy1071:
 		}
 	}
 yy1072:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1074;
 		if (yych <= '/') goto yy978;
@@ -7782,8 +8799,8 @@ yy1072:
 		}
 	}
 yy1073:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7805,8 +8822,8 @@ yy1073:
 		}
 	}
 yy1074:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1076;
 		if (yych <= '/') goto yy978;
@@ -7822,8 +8839,8 @@ yy1074:
 		}
 	}
 yy1075:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7845,8 +8862,8 @@ yy1075:
 		}
 	}
 yy1076:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1078;
 		if (yych <= '/') goto yy978;
@@ -7862,8 +8879,8 @@ yy1076:
 		}
 	}
 yy1077:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7885,8 +8902,8 @@ yy1077:
 		}
 	}
 yy1078:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1080;
 		if (yych <= '/') goto yy978;
@@ -7902,8 +8919,8 @@ yy1078:
 		}
 	}
 yy1079:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7925,8 +8942,8 @@ yy1079:
 		}
 	}
 yy1080:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1082;
 		if (yych <= '/') goto yy978;
@@ -7942,8 +8959,8 @@ yy1080:
 		}
 	}
 yy1081:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -7965,8 +8982,8 @@ yy1081:
 		}
 	}
 yy1082:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1084;
 		if (yych <= '/') goto yy978;
@@ -7982,8 +8999,8 @@ yy1082:
 		}
 	}
 yy1083:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8005,8 +9022,8 @@ yy1083:
 		}
 	}
 yy1084:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1086;
 		if (yych <= '/') goto yy978;
@@ -8022,8 +9039,8 @@ yy1084:
 		}
 	}
 yy1085:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8045,8 +9062,8 @@ yy1085:
 		}
 	}
 yy1086:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1088;
 		if (yych <= '/') goto yy978;
@@ -8062,8 +9079,8 @@ yy1086:
 		}
 	}
 yy1087:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8085,8 +9102,8 @@ yy1087:
 		}
 	}
 yy1088:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1090;
 		if (yych <= '/') goto yy978;
@@ -8102,8 +9119,8 @@ yy1088:
 		}
 	}
 yy1089:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8125,8 +9142,8 @@ yy1089:
 		}
 	}
 yy1090:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1092;
 		if (yych <= '/') goto yy978;
@@ -8142,8 +9159,8 @@ yy1090:
 		}
 	}
 yy1091:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8165,8 +9182,8 @@ yy1091:
 		}
 	}
 yy1092:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1094;
 		if (yych <= '/') goto yy978;
@@ -8182,8 +9199,8 @@ yy1092:
 		}
 	}
 yy1093:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8205,8 +9222,8 @@ yy1093:
 		}
 	}
 yy1094:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1096;
 		if (yych <= '/') goto yy978;
@@ -8222,8 +9239,8 @@ yy1094:
 		}
 	}
 yy1095:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8245,8 +9262,8 @@ yy1095:
 		}
 	}
 yy1096:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1098;
 		if (yych <= '/') goto yy978;
@@ -8262,8 +9279,8 @@ yy1096:
 		}
 	}
 yy1097:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8285,8 +9302,8 @@ yy1097:
 		}
 	}
 yy1098:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1100;
 		if (yych <= '/') goto yy978;
@@ -8302,8 +9319,8 @@ yy1098:
 		}
 	}
 yy1099:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8325,8 +9342,8 @@ yy1099:
 		}
 	}
 yy1100:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1102;
 		if (yych <= '/') goto yy978;
@@ -8342,8 +9359,8 @@ yy1100:
 		}
 	}
 yy1101:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8365,8 +9382,8 @@ yy1101:
 		}
 	}
 yy1102:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1104;
 		if (yych <= '/') goto yy978;
@@ -8382,8 +9399,8 @@ yy1102:
 		}
 	}
 yy1103:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8405,8 +9422,8 @@ yy1103:
 		}
 	}
 yy1104:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1106;
 		if (yych <= '/') goto yy978;
@@ -8422,8 +9439,8 @@ yy1104:
 		}
 	}
 yy1105:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8445,8 +9462,8 @@ yy1105:
 		}
 	}
 yy1106:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1108;
 		if (yych <= '/') goto yy978;
@@ -8462,8 +9479,8 @@ yy1106:
 		}
 	}
 yy1107:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8485,8 +9502,8 @@ yy1107:
 		}
 	}
 yy1108:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy978;
 		if (yych <= '9') goto yy1110;
@@ -8498,8 +9515,8 @@ yy1108:
 		goto yy978;
 	}
 yy1109:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= '-') goto yy978;
@@ -8518,13 +9535,14 @@ yy1109:
 		}
 	}
 yy1110:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '.') goto yy984;
 	if (yych == '>') goto yy985;
 	goto yy978;
 yy1111:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1113;
 		if (yych <= '/') goto yy978;
@@ -8540,7 +9558,8 @@ yy1111:
 		}
 	}
 yy1112:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8562,7 +9581,8 @@ yy1112:
 		}
 	}
 yy1113:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1115;
 		if (yych <= '/') goto yy978;
@@ -8578,7 +9598,8 @@ yy1113:
 		}
 	}
 yy1114:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8600,7 +9621,8 @@ yy1114:
 		}
 	}
 yy1115:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1117;
 		if (yych <= '/') goto yy978;
@@ -8616,7 +9638,8 @@ yy1115:
 		}
 	}
 yy1116:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8638,7 +9661,8 @@ yy1116:
 		}
 	}
 yy1117:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1119;
 		if (yych <= '/') goto yy978;
@@ -8654,7 +9678,8 @@ yy1117:
 		}
 	}
 yy1118:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8676,7 +9701,8 @@ yy1118:
 		}
 	}
 yy1119:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1121;
 		if (yych <= '/') goto yy978;
@@ -8692,7 +9718,8 @@ yy1119:
 		}
 	}
 yy1120:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8714,7 +9741,8 @@ yy1120:
 		}
 	}
 yy1121:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1123;
 		if (yych <= '/') goto yy978;
@@ -8730,7 +9758,8 @@ yy1121:
 		}
 	}
 yy1122:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8752,7 +9781,8 @@ yy1122:
 		}
 	}
 yy1123:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1125;
 		if (yych <= '/') goto yy978;
@@ -8768,7 +9798,8 @@ yy1123:
 		}
 	}
 yy1124:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8790,7 +9821,8 @@ yy1124:
 		}
 	}
 yy1125:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1127;
 		if (yych <= '/') goto yy978;
@@ -8806,7 +9838,8 @@ yy1125:
 		}
 	}
 yy1126:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8828,7 +9861,8 @@ yy1126:
 		}
 	}
 yy1127:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1129;
 		if (yych <= '/') goto yy978;
@@ -8844,7 +9878,8 @@ yy1127:
 		}
 	}
 yy1128:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8866,7 +9901,8 @@ yy1128:
 		}
 	}
 yy1129:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1131;
 		if (yych <= '/') goto yy978;
@@ -8882,7 +9918,8 @@ yy1129:
 		}
 	}
 yy1130:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8904,7 +9941,8 @@ yy1130:
 		}
 	}
 yy1131:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1133;
 		if (yych <= '/') goto yy978;
@@ -8920,7 +9958,8 @@ yy1131:
 		}
 	}
 yy1132:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8942,7 +9981,8 @@ yy1132:
 		}
 	}
 yy1133:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1135;
 		if (yych <= '/') goto yy978;
@@ -8958,7 +9998,8 @@ yy1133:
 		}
 	}
 yy1134:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -8980,7 +10021,8 @@ yy1134:
 		}
 	}
 yy1135:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1137;
 		if (yych <= '/') goto yy978;
@@ -8996,7 +10038,8 @@ yy1135:
 		}
 	}
 yy1136:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9018,7 +10061,8 @@ yy1136:
 		}
 	}
 yy1137:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1139;
 		if (yych <= '/') goto yy978;
@@ -9034,7 +10078,8 @@ yy1137:
 		}
 	}
 yy1138:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9056,7 +10101,8 @@ yy1138:
 		}
 	}
 yy1139:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1141;
 		if (yych <= '/') goto yy978;
@@ -9072,7 +10118,8 @@ yy1139:
 		}
 	}
 yy1140:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9094,7 +10141,8 @@ yy1140:
 		}
 	}
 yy1141:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1143;
 		if (yych <= '/') goto yy978;
@@ -9110,7 +10158,8 @@ yy1141:
 		}
 	}
 yy1142:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9132,7 +10181,8 @@ yy1142:
 		}
 	}
 yy1143:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1145;
 		if (yych <= '/') goto yy978;
@@ -9148,7 +10198,8 @@ yy1143:
 		}
 	}
 yy1144:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9170,7 +10221,8 @@ yy1144:
 		}
 	}
 yy1145:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1147;
 		if (yych <= '/') goto yy978;
@@ -9186,7 +10238,8 @@ yy1145:
 		}
 	}
 yy1146:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9208,7 +10261,8 @@ yy1146:
 		}
 	}
 yy1147:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1149;
 		if (yych <= '/') goto yy978;
@@ -9224,7 +10278,8 @@ yy1147:
 		}
 	}
 yy1148:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9246,7 +10301,8 @@ yy1148:
 		}
 	}
 yy1149:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1151;
 		if (yych <= '/') goto yy978;
@@ -9262,7 +10318,8 @@ yy1149:
 		}
 	}
 yy1150:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9284,7 +10341,8 @@ yy1150:
 		}
 	}
 yy1151:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1153;
 		if (yych <= '/') goto yy978;
@@ -9300,7 +10358,8 @@ yy1151:
 		}
 	}
 yy1152:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9322,7 +10381,8 @@ yy1152:
 		}
 	}
 yy1153:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1155;
 		if (yych <= '/') goto yy978;
@@ -9338,7 +10398,8 @@ yy1153:
 		}
 	}
 yy1154:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9360,7 +10421,8 @@ yy1154:
 		}
 	}
 yy1155:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1157;
 		if (yych <= '/') goto yy978;
@@ -9376,7 +10438,8 @@ yy1155:
 		}
 	}
 yy1156:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9398,7 +10461,8 @@ yy1156:
 		}
 	}
 yy1157:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1159;
 		if (yych <= '/') goto yy978;
@@ -9414,7 +10478,8 @@ yy1157:
 		}
 	}
 yy1158:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9436,7 +10501,8 @@ yy1158:
 		}
 	}
 yy1159:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1161;
 		if (yych <= '/') goto yy978;
@@ -9452,7 +10518,8 @@ yy1159:
 		}
 	}
 yy1160:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9474,7 +10541,8 @@ yy1160:
 		}
 	}
 yy1161:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1163;
 		if (yych <= '/') goto yy978;
@@ -9490,7 +10558,8 @@ yy1161:
 		}
 	}
 yy1162:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9512,7 +10581,8 @@ yy1162:
 		}
 	}
 yy1163:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1165;
 		if (yych <= '/') goto yy978;
@@ -9528,7 +10598,8 @@ yy1163:
 		}
 	}
 yy1164:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9550,7 +10621,8 @@ yy1164:
 		}
 	}
 yy1165:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1167;
 		if (yych <= '/') goto yy978;
@@ -9566,7 +10638,8 @@ yy1165:
 		}
 	}
 yy1166:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9588,7 +10661,8 @@ yy1166:
 		}
 	}
 yy1167:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1169;
 		if (yych <= '/') goto yy978;
@@ -9604,7 +10678,8 @@ yy1167:
 		}
 	}
 yy1168:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9626,7 +10701,8 @@ yy1168:
 		}
 	}
 yy1169:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1171;
 		if (yych <= '/') goto yy978;
@@ -9642,7 +10718,8 @@ yy1169:
 		}
 	}
 yy1170:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9664,7 +10741,8 @@ yy1170:
 		}
 	}
 yy1171:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1173;
 		if (yych <= '/') goto yy978;
@@ -9680,7 +10758,8 @@ yy1171:
 		}
 	}
 yy1172:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9702,7 +10781,8 @@ yy1172:
 		}
 	}
 yy1173:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1175;
 		if (yych <= '/') goto yy978;
@@ -9718,7 +10798,8 @@ yy1173:
 		}
 	}
 yy1174:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9740,7 +10821,8 @@ yy1174:
 		}
 	}
 yy1175:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1177;
 		if (yych <= '/') goto yy978;
@@ -9756,7 +10838,8 @@ yy1175:
 		}
 	}
 yy1176:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9778,7 +10861,8 @@ yy1176:
 		}
 	}
 yy1177:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1179;
 		if (yych <= '/') goto yy978;
@@ -9794,7 +10878,8 @@ yy1177:
 		}
 	}
 yy1178:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9816,7 +10901,8 @@ yy1178:
 		}
 	}
 yy1179:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1181;
 		if (yych <= '/') goto yy978;
@@ -9832,7 +10918,8 @@ yy1179:
 		}
 	}
 yy1180:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9854,7 +10941,8 @@ yy1180:
 		}
 	}
 yy1181:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1183;
 		if (yych <= '/') goto yy978;
@@ -9870,7 +10958,8 @@ yy1181:
 		}
 	}
 yy1182:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9892,7 +10981,8 @@ yy1182:
 		}
 	}
 yy1183:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1185;
 		if (yych <= '/') goto yy978;
@@ -9908,7 +10998,8 @@ yy1183:
 		}
 	}
 yy1184:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9930,7 +11021,8 @@ yy1184:
 		}
 	}
 yy1185:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1187;
 		if (yych <= '/') goto yy978;
@@ -9946,7 +11038,8 @@ yy1185:
 		}
 	}
 yy1186:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -9968,7 +11061,8 @@ yy1186:
 		}
 	}
 yy1187:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1189;
 		if (yych <= '/') goto yy978;
@@ -9984,7 +11078,8 @@ yy1187:
 		}
 	}
 yy1188:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10006,7 +11101,8 @@ yy1188:
 		}
 	}
 yy1189:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1191;
 		if (yych <= '/') goto yy978;
@@ -10022,7 +11118,8 @@ yy1189:
 		}
 	}
 yy1190:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10044,7 +11141,8 @@ yy1190:
 		}
 	}
 yy1191:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1193;
 		if (yych <= '/') goto yy978;
@@ -10060,7 +11158,8 @@ yy1191:
 		}
 	}
 yy1192:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10082,7 +11181,8 @@ yy1192:
 		}
 	}
 yy1193:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1195;
 		if (yych <= '/') goto yy978;
@@ -10098,7 +11198,8 @@ yy1193:
 		}
 	}
 yy1194:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10120,7 +11221,8 @@ yy1194:
 		}
 	}
 yy1195:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1197;
 		if (yych <= '/') goto yy978;
@@ -10136,7 +11238,8 @@ yy1195:
 		}
 	}
 yy1196:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10158,7 +11261,8 @@ yy1196:
 		}
 	}
 yy1197:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1199;
 		if (yych <= '/') goto yy978;
@@ -10174,7 +11278,8 @@ yy1197:
 		}
 	}
 yy1198:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10196,7 +11301,8 @@ yy1198:
 		}
 	}
 yy1199:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1201;
 		if (yych <= '/') goto yy978;
@@ -10212,7 +11318,8 @@ yy1199:
 		}
 	}
 yy1200:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10234,7 +11341,8 @@ yy1200:
 		}
 	}
 yy1201:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1203;
 		if (yych <= '/') goto yy978;
@@ -10250,7 +11358,8 @@ yy1201:
 		}
 	}
 yy1202:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10272,7 +11381,8 @@ yy1202:
 		}
 	}
 yy1203:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1205;
 		if (yych <= '/') goto yy978;
@@ -10288,7 +11398,8 @@ yy1203:
 		}
 	}
 yy1204:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10310,7 +11421,8 @@ yy1204:
 		}
 	}
 yy1205:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1207;
 		if (yych <= '/') goto yy978;
@@ -10326,7 +11438,8 @@ yy1205:
 		}
 	}
 yy1206:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10348,7 +11461,8 @@ yy1206:
 		}
 	}
 yy1207:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1209;
 		if (yych <= '/') goto yy978;
@@ -10364,7 +11478,8 @@ yy1207:
 		}
 	}
 yy1208:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10386,7 +11501,8 @@ yy1208:
 		}
 	}
 yy1209:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1211;
 		if (yych <= '/') goto yy978;
@@ -10402,7 +11518,8 @@ yy1209:
 		}
 	}
 yy1210:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10424,7 +11541,8 @@ yy1210:
 		}
 	}
 yy1211:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1213;
 		if (yych <= '/') goto yy978;
@@ -10440,7 +11558,8 @@ yy1211:
 		}
 	}
 yy1212:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10462,7 +11581,8 @@ yy1212:
 		}
 	}
 yy1213:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1215;
 		if (yych <= '/') goto yy978;
@@ -10478,7 +11598,8 @@ yy1213:
 		}
 	}
 yy1214:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10500,7 +11621,8 @@ yy1214:
 		}
 	}
 yy1215:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1217;
 		if (yych <= '/') goto yy978;
@@ -10516,7 +11638,8 @@ yy1215:
 		}
 	}
 yy1216:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10538,7 +11661,8 @@ yy1216:
 		}
 	}
 yy1217:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1219;
 		if (yych <= '/') goto yy978;
@@ -10554,7 +11678,8 @@ yy1217:
 		}
 	}
 yy1218:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10576,7 +11701,8 @@ yy1218:
 		}
 	}
 yy1219:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1221;
 		if (yych <= '/') goto yy978;
@@ -10592,7 +11718,8 @@ yy1219:
 		}
 	}
 yy1220:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10614,7 +11741,8 @@ yy1220:
 		}
 	}
 yy1221:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1223;
 		if (yych <= '/') goto yy978;
@@ -10630,7 +11758,8 @@ yy1221:
 		}
 	}
 yy1222:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10652,7 +11781,8 @@ yy1222:
 		}
 	}
 yy1223:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1225;
 		if (yych <= '/') goto yy978;
@@ -10668,7 +11798,8 @@ yy1223:
 		}
 	}
 yy1224:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10690,7 +11821,8 @@ yy1224:
 		}
 	}
 yy1225:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1227;
 		if (yych <= '/') goto yy978;
@@ -10706,7 +11838,8 @@ yy1225:
 		}
 	}
 yy1226:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10728,7 +11861,8 @@ yy1226:
 		}
 	}
 yy1227:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych == '-') goto yy1229;
 		if (yych <= '/') goto yy978;
@@ -10744,7 +11878,8 @@ yy1227:
 		}
 	}
 yy1228:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '.') {
 			if (yych <= ',') goto yy978;
@@ -10766,7 +11901,8 @@ yy1228:
 		}
 	}
 yy1229:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy978;
 		if (yych <= '9') goto yy1110;
@@ -10778,8 +11914,8 @@ yy1229:
 		goto yy978;
 	}
 yy1230:
-	++p;
-	if ((yych = *p) <= '=') {
+	YYSKIP ();
+	if ((yych = YYPEEK ()) <= '=') {
 		if (yych <= '.') {
 			if (yych <= '-') goto yy978;
 			goto yy984;
@@ -10804,7 +11940,7 @@ yy1230:
 }
 
 //Try to scan for the pattern {#...}
-int _scan_autolink_inline(const unsigned char *p)
+int _scan_autolink_inline(const unsigned char *p, const unsigned char *end)
 {
     const unsigned char *start = p;
 
@@ -10844,24 +11980,26 @@ int _scan_autolink_inline(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1233;
 	if (yych == '#') goto yy1234;
 	goto yy1235;
 yy1233:
 	{ return 0; }
 yy1234:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1236;
 	}
 	goto yy1233;
 yy1235:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1233;
 yy1236:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1236;
 	}
@@ -10871,7 +12009,7 @@ yy1236:
 }
 
 //Try to scan for the pattern {toc}
-int _scan_toc_inline(const unsigned char *p)
+int _scan_toc_inline(const unsigned char *p, const unsigned char *end)
 {
     const unsigned char *marker = NULL;
     const unsigned char *start = p;
@@ -10912,14 +12050,16 @@ int _scan_toc_inline(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1241;
 	if (yych == '{') goto yy1242;
 	goto yy1243;
 yy1241:
 	{ return 0; }
 yy1242:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1244;
 	}
@@ -10927,36 +12067,41 @@ yy1242:
 	if (yych == 't') goto yy1247;
 	goto yy1241;
 yy1243:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1241;
 yy1244:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1244;
 	}
 	if (yych == 'T') goto yy1247;
 	if (yych == 't') goto yy1247;
 yy1246:
-	p = marker;
+	YYRESTORE ();
 	goto yy1241;
 yy1247:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1248;
 	if (yych != 'o') goto yy1246;
 yy1248:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1249;
 	if (yych != 'c') goto yy1246;
 yy1249:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != ':') goto yy1252;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '0') goto yy1246;
 	if (yych >= '7') goto yy1246;
 yy1251:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1252:
 	if (yych <= 0x1F) {
 		if (yych <= 0x08) goto yy1246;
@@ -10966,14 +12111,14 @@ yy1252:
 		if (yych <= ' ') goto yy1251;
 		if (yych != '}') goto yy1246;
 	}
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 }
 
 }
 
 // Try to match an HTML tag after first <, returning num of chars matched.
-int _scan_html_tag(const unsigned char *p)
+int _scan_html_tag(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -11048,7 +12193,7 @@ int _scan_html_tag(const unsigned char *p)
 		160, 160, 160, 160, 160, 160, 160, 160, 
 		160, 160, 160, 160, 160, 160, 160, 160, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '/') {
 		if (yych <= ' ') {
 			if (yych != '\n') goto yy1262;
@@ -11071,7 +12216,9 @@ int _scan_html_tag(const unsigned char *p)
 yy1257:
 	{ return 0; }
 yy1258:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych <= 0x1F) {
 			if (yych <= 0x08) goto yy1257;
@@ -11095,14 +12242,18 @@ yy1258:
 		}
 	}
 yy1259:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= '@') goto yy1257;
 	if (yych <= 'Z') goto yy1293;
 	if (yych <= '`') goto yy1257;
 	if (yych <= 'z') goto yy1293;
 	goto yy1257;
 yy1260:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[256+yych] & 64) {
 		goto yy1270;
 	}
@@ -11111,39 +12262,43 @@ yy1260:
 	if (yych <= '[') goto yy1269;
 	goto yy1257;
 yy1261:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1257;
 	goto yy1264;
 yy1262:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1257;
 yy1263:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1264:
 	if (yybm[256+yych] & 32) {
 		goto yy1263;
 	}
 	if (yych >= 0x01) goto yy1266;
 yy1265:
-	p = marker;
+	YYRESTORE ();
 	goto yy1257;
 yy1266:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1265;
 	if (yych != '>') goto yy1263;
 yy1267:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1269:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1284;
 	if (yych == 'c') goto yy1284;
 	goto yy1265;
 yy1270:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 1) {
 		goto yy1280;
 	}
@@ -11151,94 +12306,104 @@ yy1270:
 	if (yych <= 'Z') goto yy1270;
 	goto yy1265;
 yy1272:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '-') goto yy1265;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy1274;
 	if (yych == '>') goto yy1265;
 	goto yy1276;
 yy1274:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '-') goto yy1279;
 	if (yych == '>') goto yy1265;
 	goto yy1276;
 yy1275:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1276:
 	if (yybm[256+yych] & 128) {
 		goto yy1275;
 	}
 	if (yych <= 0x00) goto yy1265;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[256+yych] & 128) {
 		goto yy1275;
 	}
 	if (yych <= 0x00) goto yy1265;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '>') goto yy1267;
 	goto yy1265;
 yy1279:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '>') goto yy1267;
 	goto yy1265;
 yy1280:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 1) {
 		goto yy1280;
 	}
 	if (yych <= 0x00) goto yy1265;
 	if (yych == '>') goto yy1267;
 yy1282:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 2) {
 		goto yy1282;
 	}
 	if (yych <= 0x00) goto yy1265;
 	goto yy1267;
 yy1284:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1285;
 	if (yych != 'd') goto yy1265;
 yy1285:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1286;
 	if (yych != 'a') goto yy1265;
 yy1286:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1287;
 	if (yych != 't') goto yy1265;
 yy1287:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1288;
 	if (yych != 'a') goto yy1265;
 yy1288:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych != '[') goto yy1265;
 yy1289:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 4) {
 		goto yy1289;
 	}
 	if (yych <= 0x00) goto yy1265;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 4) {
 		goto yy1289;
 	}
 	if (yych <= 0x00) goto yy1265;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1265;
 	if (yych == '>') goto yy1267;
 	goto yy1289;
 yy1293:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 8) {
 		goto yy1293;
 	}
@@ -11251,8 +12416,8 @@ yy1293:
 		goto yy1265;
 	}
 yy1295:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 0x1F) {
 		if (yych <= 0x08) goto yy1265;
 		if (yych <= '\r') goto yy1295;
@@ -11263,8 +12428,8 @@ yy1295:
 		goto yy1265;
 	}
 yy1297:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych <= 0x1F) {
 			if (yych <= 0x08) goto yy1265;
@@ -11287,8 +12452,8 @@ yy1297:
 		}
 	}
 yy1299:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ':') {
 		if (yych <= ' ') {
 			if (yych <= 0x08) goto yy1265;
@@ -11317,12 +12482,13 @@ yy1299:
 		}
 	}
 yy1301:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '>') goto yy1267;
 	goto yy1265;
 yy1302:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 16) {
 		goto yy1302;
 	}
@@ -11343,8 +12509,8 @@ yy1302:
 		}
 	}
 yy1304:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '<') {
 		if (yych <= ' ') {
 			if (yych <= 0x08) goto yy1265;
@@ -11378,8 +12544,8 @@ yy1304:
 		}
 	}
 yy1306:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1308;
 	}
@@ -11389,8 +12555,8 @@ yy1306:
 	if (yych <= '\'') goto yy1310;
 	goto yy1265;
 yy1307:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1308;
 	}
@@ -11404,8 +12570,8 @@ yy1307:
 		goto yy1265;
 	}
 yy1308:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1308;
 	}
@@ -11414,23 +12580,23 @@ yy1308:
 	if (yych == '>') goto yy1267;
 	goto yy1265;
 yy1310:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1310;
 	}
 	if (yych <= 0x00) goto yy1265;
 	goto yy1314;
 yy1312:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1312;
 	}
 	if (yych <= 0x00) goto yy1265;
 yy1314:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ' ') {
 		if (yych <= 0x08) goto yy1265;
 		if (yych <= '\r') goto yy1299;
@@ -11446,8 +12612,8 @@ yy1314:
 		}
 	}
 yy1315:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych <= ' ') {
 			if (yych <= 0x08) {
@@ -11487,8 +12653,8 @@ yy1315:
 		}
 	}
 yy1317:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') {
 		if (yych <= '!') {
 			if (yych <= '\r') {
@@ -11532,8 +12698,8 @@ yy1317:
 		}
 	}
 yy1319:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ':') {
 		if (yych <= ' ') {
 			if (yych <= 0x08) {
@@ -11577,8 +12743,8 @@ yy1319:
 		}
 	}
 yy1321:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '9') {
 		if (yych <= ' ') {
 			if (yych <= 0x08) {
@@ -11626,21 +12792,23 @@ yy1321:
 
 // Try to match an HTML block tag including first <,
 // returning num of chars matched.
-int _scan_html_block_tag(const unsigned char *p)
+int _scan_html_block_tag(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
 
 {
 	unsigned char yych;
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1325;
 	if (yych == '<') goto yy1326;
 	goto yy1327;
 yy1325:
 	{ return 0; }
 yy1326:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '!':
 	case '?':	goto yy1328;
@@ -11680,13 +12848,15 @@ yy1326:
 	default:	goto yy1325;
 	}
 yy1327:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1325;
 yy1328:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1330:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') {
 		if (yych <= 0x1F) {
 			if (yych <= 0x08) goto yy1331;
@@ -11704,10 +12874,11 @@ yy1330:
 		}
 	}
 yy1331:
-	p = marker;
+	YYRESTORE ();
 	goto yy1325;
 yy1332:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'Q') goto yy1331;
 		if (yych <= 'R') goto yy1597;
@@ -11719,7 +12890,8 @@ yy1332:
 		goto yy1331;
 	}
 yy1333:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') {
 		if (yych <= 'D') {
 			if (yych <= '0') goto yy1331;
@@ -11742,12 +12914,14 @@ yy1333:
 		}
 	}
 yy1334:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy1584;
 	if (yych == 'f') goto yy1584;
 	goto yy1331;
 yy1335:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych <= 'N') {
 			if (yych == 'L') goto yy1572;
@@ -11768,17 +12942,20 @@ yy1335:
 		}
 	}
 yy1336:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1490;
 	if (yych == 'i') goto yy1490;
 	goto yy1331;
 yy1337:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1569;
 	if (yych == 'a') goto yy1569;
 	goto yy1331;
 yy1338:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych <= 'K') {
 			if (yych == 'B') goto yy1562;
@@ -11799,7 +12976,8 @@ yy1338:
 		}
 	}
 yy1339:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'A') goto yy1548;
 		if (yych <= 'N') goto yy1331;
@@ -11814,7 +12992,8 @@ yy1339:
 		}
 	}
 yy1340:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'I') {
 			if (yych == 'D') goto yy1490;
@@ -11841,7 +13020,8 @@ yy1340:
 		}
 	}
 yy1341:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'D') {
 			if (yych == 'C') goto yy1535;
@@ -11862,7 +13042,8 @@ yy1341:
 		}
 	}
 yy1342:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1520;
@@ -11881,12 +13062,14 @@ yy1342:
 	default:	goto yy1331;
 	}
 yy1343:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1513;
 	if (yych == 'm') goto yy1513;
 	goto yy1331;
 yy1344:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'I') goto yy1494;
 		if (yych <= 'N') goto yy1331;
@@ -11901,17 +13084,20 @@ yy1344:
 		}
 	}
 yy1345:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1490;
 	if (yych == 'l') goto yy1490;
 	goto yy1331;
 yy1346:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1487;
 	if (yych == 'i') goto yy1487;
 	goto yy1331;
 yy1347:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1349;
@@ -11948,7 +13134,8 @@ yy1347:
 	default:	goto yy1331;
 	}
 yy1348:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '\r') {
 			if (yych <= 0x08) goto yy1331;
@@ -11968,7 +13155,8 @@ yy1348:
 		}
 	}
 yy1349:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'S') {
 		if (yych <= 'Q') goto yy1331;
 		if (yych <= 'R') goto yy1474;
@@ -11980,7 +13168,8 @@ yy1349:
 		goto yy1331;
 	}
 yy1350:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'Q') {
 		if (yych <= 'D') {
 			if (yych <= '0') goto yy1331;
@@ -12003,12 +13192,14 @@ yy1350:
 		}
 	}
 yy1351:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'F') goto yy1461;
 	if (yych == 'f') goto yy1461;
 	goto yy1331;
 yy1352:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych <= 'N') {
 			if (yych == 'L') goto yy1449;
@@ -12029,17 +13220,20 @@ yy1352:
 		}
 	}
 yy1353:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1367;
 	if (yych == 'i') goto yy1367;
 	goto yy1331;
 yy1354:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1446;
 	if (yych == 'a') goto yy1446;
 	goto yy1331;
 yy1355:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych <= 'K') {
 			if (yych == 'B') goto yy1439;
@@ -12060,7 +13254,8 @@ yy1355:
 		}
 	}
 yy1356:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'A') goto yy1425;
 		if (yych <= 'N') goto yy1331;
@@ -12075,7 +13270,8 @@ yy1356:
 		}
 	}
 yy1357:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'I') {
 			if (yych == 'D') goto yy1367;
@@ -12102,7 +13298,8 @@ yy1357:
 		}
 	}
 yy1358:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'T') {
 		if (yych <= 'D') {
 			if (yych == 'C') goto yy1412;
@@ -12123,7 +13320,8 @@ yy1358:
 		}
 	}
 yy1359:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1397;
@@ -12142,12 +13340,14 @@ yy1359:
 	default:	goto yy1331;
 	}
 yy1360:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1390;
 	if (yych == 'm') goto yy1390;
 	goto yy1331;
 yy1361:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'I') goto yy1371;
 		if (yych <= 'N') goto yy1331;
@@ -12162,28 +13362,34 @@ yy1361:
 		}
 	}
 yy1362:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1367;
 	if (yych == 'l') goto yy1367;
 	goto yy1331;
 yy1363:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1364;
 	if (yych != 'i') goto yy1331;
 yy1364:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1365;
 	if (yych != 'd') goto yy1331;
 yy1365:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1366;
 	if (yych != 'e') goto yy1331;
 yy1366:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1367;
 	if (yych != 'o') goto yy1331;
 yy1367:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 0x1F) {
 		if (yych <= 0x08) goto yy1331;
 		if (yych >= 0x0E) goto yy1331;
@@ -12192,10 +13398,11 @@ yy1367:
 		if (yych != '>') goto yy1331;
 	}
 yy1368:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1370:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == 'O') goto yy1386;
 		if (yych <= 'Q') goto yy1331;
@@ -12210,7 +13417,8 @@ yy1370:
 		}
 	}
 yy1371:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'G') {
 		if (yych == 'E') goto yy1372;
 		if (yych <= 'F') goto yy1331;
@@ -12224,12 +13432,14 @@ yy1371:
 		}
 	}
 yy1372:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1382;
 	if (yych == 'l') goto yy1382;
 	goto yy1331;
 yy1373:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych == 'C') goto yy1375;
 		if (yych <= 'T') goto yy1331;
@@ -12241,91 +13451,111 @@ yy1373:
 			if (yych != 'u') goto yy1331;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1381;
 	if (yych == 'r') goto yy1381;
 	goto yy1331;
 yy1375:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1376;
 	if (yych != 'a') goto yy1331;
 yy1376:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1377;
 	if (yych != 'p') goto yy1331;
 yy1377:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1378;
 	if (yych != 't') goto yy1331;
 yy1378:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1379;
 	if (yych != 'i') goto yy1331;
 yy1379:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1380;
 	if (yych != 'o') goto yy1331;
 yy1380:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1367;
 	if (yych == 'n') goto yy1367;
 	goto yy1331;
 yy1381:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1382:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1383;
 	if (yych != 'd') goto yy1331;
 yy1383:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1384;
 	if (yych != 's') goto yy1331;
 yy1384:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1385;
 	if (yych != 'e') goto yy1331;
 yy1385:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1367;
 	if (yych == 't') goto yy1367;
 	goto yy1331;
 yy1386:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1388;
 	if (yych == 't') goto yy1388;
 	goto yy1331;
 yy1387:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1367;
 	if (yych == 'm') goto yy1367;
 	goto yy1331;
 yy1388:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1389;
 	if (yych != 'e') goto yy1331;
 yy1389:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1367;
 	if (yych == 'r') goto yy1367;
 	goto yy1331;
 yy1390:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy1391;
 	if (yych != 'b') goto yy1331;
 yy1391:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1392;
 	if (yych != 'e') goto yy1331;
 yy1392:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1367;
 	if (yych == 'd') goto yy1367;
 	goto yy1331;
 yy1393:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '\r') {
 			if (yych <= 0x08) goto yy1331;
@@ -12345,146 +13575,178 @@ yy1393:
 		}
 	}
 yy1394:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1407;
 	if (yych == 'o') goto yy1407;
 	goto yy1331;
 yy1395:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy1402;
 	if (yych == 'x') goto yy1402;
 	goto yy1331;
 yy1396:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1400;
 	if (yych == 'o') goto yy1400;
 	goto yy1331;
 yy1397:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy1398;
 	if (yych != 'b') goto yy1331;
 yy1398:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1399;
 	if (yych != 'l') goto yy1331;
 yy1399:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1400:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1401;
 	if (yych != 'd') goto yy1331;
 yy1401:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1367;
 	if (yych == 'y') goto yy1367;
 	goto yy1331;
 yy1402:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1403;
 	if (yych != 't') goto yy1331;
 yy1403:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1404;
 	if (yych != 'a') goto yy1331;
 yy1404:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1405;
 	if (yych != 'r') goto yy1331;
 yy1405:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1406;
 	if (yych != 'e') goto yy1331;
 yy1406:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1367;
 	if (yych == 'a') goto yy1367;
 	goto yy1331;
 yy1407:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1408;
 	if (yych != 'o') goto yy1331;
 yy1408:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1367;
 	if (yych == 't') goto yy1367;
 	goto yy1331;
 yy1409:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1410;
 	if (yych != 'a') goto yy1331;
 yy1410:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1367;
 	if (yych == 'd') goto yy1367;
 	goto yy1331;
 yy1411:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1421;
 	if (yych == 'y') goto yy1421;
 	goto yy1331;
 yy1412:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1418;
 	if (yych == 'r') goto yy1418;
 	goto yy1331;
 yy1413:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1414;
 	if (yych != 'c') goto yy1331;
 yy1414:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1415;
 	if (yych != 't') goto yy1331;
 yy1415:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1416;
 	if (yych != 'i') goto yy1331;
 yy1416:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1417;
 	if (yych != 'o') goto yy1331;
 yy1417:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1367;
 	if (yych == 'n') goto yy1367;
 	goto yy1331;
 yy1418:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1419;
 	if (yych != 'i') goto yy1331;
 yy1419:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1420;
 	if (yych != 'p') goto yy1331;
 yy1420:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1367;
 	if (yych == 't') goto yy1367;
 	goto yy1331;
 yy1421:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1422;
 	if (yych != 'l') goto yy1331;
 yy1422:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1423:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy1367;
 	if (yych == 'v') goto yy1367;
 	goto yy1331;
 yy1424:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1433;
 	if (yych == 'l') goto yy1433;
 	goto yy1331;
 yy1425:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'N') goto yy1426;
 		if (yych <= 'O') goto yy1331;
@@ -12498,38 +13760,46 @@ yy1425:
 		}
 	}
 yy1426:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy1431;
 	if (yych == 'v') goto yy1431;
 	goto yy1331;
 yy1427:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1428;
 	if (yych != 't') goto yy1331;
 yy1428:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1429;
 	if (yych != 'i') goto yy1331;
 yy1429:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1430;
 	if (yych != 'o') goto yy1331;
 yy1430:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1367;
 	if (yych == 'n') goto yy1367;
 	goto yy1331;
 yy1431:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1432;
 	if (yych != 'a') goto yy1331;
 yy1432:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1367;
 	if (yych == 's') goto yy1367;
 	goto yy1331;
 yy1433:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '=') {
 		if (yych <= '\r') {
 			if (yych <= 0x08) goto yy1331;
@@ -12546,212 +13816,260 @@ yy1433:
 			if (yych != 'g') goto yy1331;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1435;
 	if (yych != 'r') goto yy1331;
 yy1435:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1436;
 	if (yych != 'o') goto yy1331;
 yy1436:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1437;
 	if (yych != 'u') goto yy1331;
 yy1437:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1367;
 	if (yych == 'p') goto yy1367;
 	goto yy1331;
 yy1438:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1443;
 	if (yych == 't') goto yy1443;
 	goto yy1331;
 yy1439:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'J') goto yy1440;
 	if (yych != 'j') goto yy1331;
 yy1440:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1441;
 	if (yych != 'e') goto yy1331;
 yy1441:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1442;
 	if (yych != 'c') goto yy1331;
 yy1442:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1367;
 	if (yych == 't') goto yy1367;
 	goto yy1331;
 yy1443:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1444;
 	if (yych != 'p') goto yy1331;
 yy1444:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1445;
 	if (yych != 'u') goto yy1331;
 yy1445:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1367;
 	if (yych == 't') goto yy1367;
 	goto yy1331;
 yy1446:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1367;
 	if (yych == 'p') goto yy1367;
 	goto yy1331;
 yy1447:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1458;
 	if (yych == 't') goto yy1458;
 	goto yy1331;
 yy1448:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1457;
 	if (yych == 'd') goto yy1457;
 	goto yy1331;
 yy1449:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1450;
 	if (yych != 'o') goto yy1331;
 yy1450:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1451;
 	if (yych != 'c') goto yy1331;
 yy1451:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy1452;
 	if (yych != 'k') goto yy1331;
 yy1452:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy1453;
 	if (yych != 'q') goto yy1331;
 yy1453:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1454;
 	if (yych != 'u') goto yy1331;
 yy1454:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1455;
 	if (yych != 'o') goto yy1331;
 yy1455:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1456;
 	if (yych != 't') goto yy1331;
 yy1456:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1457:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1367;
 	if (yych == 'y') goto yy1367;
 	goto yy1331;
 yy1458:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1459;
 	if (yych != 't') goto yy1331;
 yy1459:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1460;
 	if (yych != 'o') goto yy1331;
 yy1460:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1367;
 	if (yych == 'n') goto yy1367;
 	goto yy1331;
 yy1461:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1462;
 	if (yych != 'r') goto yy1331;
 yy1462:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1463;
 	if (yych != 'a') goto yy1331;
 yy1463:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1464;
 	if (yych != 'm') goto yy1331;
 yy1464:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1465:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1470;
 	if (yych == 'r') goto yy1470;
 	goto yy1331;
 yy1466:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1467;
 	if (yych != 'a') goto yy1331;
 yy1467:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1468;
 	if (yych != 'd') goto yy1331;
 yy1468:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1469;
 	if (yych != 'e') goto yy1331;
 yy1469:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1367;
 	if (yych == 'r') goto yy1367;
 	goto yy1331;
 yy1470:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1471;
 	if (yych != 'o') goto yy1331;
 yy1471:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1472;
 	if (yych != 'u') goto yy1331;
 yy1472:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1367;
 	if (yych == 'p') goto yy1367;
 	goto yy1331;
 yy1473:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1479;
 	if (yych == 'i') goto yy1479;
 	goto yy1331;
 yy1474:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1475;
 	if (yych != 't') goto yy1331;
 yy1475:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1476;
 	if (yych != 'i') goto yy1331;
 yy1476:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1477;
 	if (yych != 'c') goto yy1331;
 yy1477:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1478;
 	if (yych != 'l') goto yy1331;
 yy1478:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1479:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1480;
 	if (yych != 'd') goto yy1331;
 yy1480:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1367;
 	if (yych == 'e') goto yy1367;
 	goto yy1331;
 yy1481:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'E') goto yy1367;
 		if (yych <= 'N') goto yy1331;
@@ -12763,40 +14081,49 @@ yy1481:
 			if (yych != 'o') goto yy1331;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy1483;
 	if (yych != 'g') goto yy1331;
 yy1483:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1484;
 	if (yych != 'r') goto yy1331;
 yy1484:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1485;
 	if (yych != 'e') goto yy1331;
 yy1485:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1486;
 	if (yych != 's') goto yy1331;
 yy1486:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1367;
 	if (yych == 's') goto yy1367;
 	goto yy1331;
 yy1487:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1488;
 	if (yych != 'd') goto yy1331;
 yy1488:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1489;
 	if (yych != 'e') goto yy1331;
 yy1489:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1490;
 	if (yych != 'o') goto yy1331;
 yy1490:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ' ') {
 		if (yych <= 0x08) goto yy1331;
 		if (yych <= '\r') goto yy1491;
@@ -12809,10 +14136,11 @@ yy1490:
 		}
 	}
 yy1491:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1493:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'R') {
 		if (yych == 'O') goto yy1509;
 		if (yych <= 'Q') goto yy1331;
@@ -12827,7 +14155,8 @@ yy1493:
 		}
 	}
 yy1494:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'G') {
 		if (yych == 'E') goto yy1495;
 		if (yych <= 'F') goto yy1331;
@@ -12841,12 +14170,14 @@ yy1494:
 		}
 	}
 yy1495:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1505;
 	if (yych == 'l') goto yy1505;
 	goto yy1331;
 yy1496:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'U') {
 		if (yych == 'C') goto yy1498;
 		if (yych <= 'T') goto yy1331;
@@ -12858,91 +14189,111 @@ yy1496:
 			if (yych != 'u') goto yy1331;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1504;
 	if (yych == 'r') goto yy1504;
 	goto yy1331;
 yy1498:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1499;
 	if (yych != 'a') goto yy1331;
 yy1499:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1500;
 	if (yych != 'p') goto yy1331;
 yy1500:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1501;
 	if (yych != 't') goto yy1331;
 yy1501:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1502;
 	if (yych != 'i') goto yy1331;
 yy1502:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1503;
 	if (yych != 'o') goto yy1331;
 yy1503:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1490;
 	if (yych == 'n') goto yy1490;
 	goto yy1331;
 yy1504:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1505:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1506;
 	if (yych != 'd') goto yy1331;
 yy1506:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1507;
 	if (yych != 's') goto yy1331;
 yy1507:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1508;
 	if (yych != 'e') goto yy1331;
 yy1508:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1490;
 	if (yych == 't') goto yy1490;
 	goto yy1331;
 yy1509:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1511;
 	if (yych == 't') goto yy1511;
 	goto yy1331;
 yy1510:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1490;
 	if (yych == 'm') goto yy1490;
 	goto yy1331;
 yy1511:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1512;
 	if (yych != 'e') goto yy1331;
 yy1512:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1490;
 	if (yych == 'r') goto yy1490;
 	goto yy1331;
 yy1513:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy1514;
 	if (yych != 'b') goto yy1331;
 yy1514:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1515;
 	if (yych != 'e') goto yy1331;
 yy1515:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1490;
 	if (yych == 'd') goto yy1490;
 	goto yy1331;
 yy1516:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') {
 		if (yych <= 0x1F) {
 			if (yych <= 0x08) goto yy1331;
@@ -12964,146 +14315,178 @@ yy1516:
 		}
 	}
 yy1517:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1530;
 	if (yych == 'o') goto yy1530;
 	goto yy1331;
 yy1518:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'X') goto yy1525;
 	if (yych == 'x') goto yy1525;
 	goto yy1331;
 yy1519:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1523;
 	if (yych == 'o') goto yy1523;
 	goto yy1331;
 yy1520:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'B') goto yy1521;
 	if (yych != 'b') goto yy1331;
 yy1521:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1522;
 	if (yych != 'l') goto yy1331;
 yy1522:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1523:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1524;
 	if (yych != 'd') goto yy1331;
 yy1524:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1490;
 	if (yych == 'y') goto yy1490;
 	goto yy1331;
 yy1525:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1526;
 	if (yych != 't') goto yy1331;
 yy1526:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1527;
 	if (yych != 'a') goto yy1331;
 yy1527:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1528;
 	if (yych != 'r') goto yy1331;
 yy1528:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1529;
 	if (yych != 'e') goto yy1331;
 yy1529:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1490;
 	if (yych == 'a') goto yy1490;
 	goto yy1331;
 yy1530:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1531;
 	if (yych != 'o') goto yy1331;
 yy1531:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1490;
 	if (yych == 't') goto yy1490;
 	goto yy1331;
 yy1532:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1533;
 	if (yych != 'a') goto yy1331;
 yy1533:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1490;
 	if (yych == 'd') goto yy1490;
 	goto yy1331;
 yy1534:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1544;
 	if (yych == 'y') goto yy1544;
 	goto yy1331;
 yy1535:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1541;
 	if (yych == 'r') goto yy1541;
 	goto yy1331;
 yy1536:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1537;
 	if (yych != 'c') goto yy1331;
 yy1537:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1538;
 	if (yych != 't') goto yy1331;
 yy1538:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1539;
 	if (yych != 'i') goto yy1331;
 yy1539:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1540;
 	if (yych != 'o') goto yy1331;
 yy1540:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1490;
 	if (yych == 'n') goto yy1490;
 	goto yy1331;
 yy1541:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1542;
 	if (yych != 'i') goto yy1331;
 yy1542:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1543;
 	if (yych != 'p') goto yy1331;
 yy1543:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1490;
 	if (yych == 't') goto yy1490;
 	goto yy1331;
 yy1544:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1545;
 	if (yych != 'l') goto yy1331;
 yy1545:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1546:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy1490;
 	if (yych == 'v') goto yy1490;
 	goto yy1331;
 yy1547:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1556;
 	if (yych == 'l') goto yy1556;
 	goto yy1331;
 yy1548:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'P') {
 		if (yych == 'N') goto yy1549;
 		if (yych <= 'O') goto yy1331;
@@ -13117,38 +14500,46 @@ yy1548:
 		}
 	}
 yy1549:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'V') goto yy1554;
 	if (yych == 'v') goto yy1554;
 	goto yy1331;
 yy1550:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1551;
 	if (yych != 't') goto yy1331;
 yy1551:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1552;
 	if (yych != 'i') goto yy1331;
 yy1552:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1553;
 	if (yych != 'o') goto yy1331;
 yy1553:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1490;
 	if (yych == 'n') goto yy1490;
 	goto yy1331;
 yy1554:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1555;
 	if (yych != 'a') goto yy1331;
 yy1555:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1490;
 	if (yych == 's') goto yy1490;
 	goto yy1331;
 yy1556:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') {
 		if (yych <= 0x1F) {
 			if (yych <= 0x08) goto yy1331;
@@ -13169,212 +14560,260 @@ yy1556:
 		}
 	}
 yy1557:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1558;
 	if (yych != 'r') goto yy1331;
 yy1558:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1559;
 	if (yych != 'o') goto yy1331;
 yy1559:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1560;
 	if (yych != 'u') goto yy1331;
 yy1560:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1490;
 	if (yych == 'p') goto yy1490;
 	goto yy1331;
 yy1561:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1566;
 	if (yych == 't') goto yy1566;
 	goto yy1331;
 yy1562:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'J') goto yy1563;
 	if (yych != 'j') goto yy1331;
 yy1563:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1564;
 	if (yych != 'e') goto yy1331;
 yy1564:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1565;
 	if (yych != 'c') goto yy1331;
 yy1565:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1490;
 	if (yych == 't') goto yy1490;
 	goto yy1331;
 yy1566:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1567;
 	if (yych != 'p') goto yy1331;
 yy1567:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1568;
 	if (yych != 'u') goto yy1331;
 yy1568:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1490;
 	if (yych == 't') goto yy1490;
 	goto yy1331;
 yy1569:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1490;
 	if (yych == 'p') goto yy1490;
 	goto yy1331;
 yy1570:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1581;
 	if (yych == 't') goto yy1581;
 	goto yy1331;
 yy1571:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1580;
 	if (yych == 'd') goto yy1580;
 	goto yy1331;
 yy1572:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1573;
 	if (yych != 'o') goto yy1331;
 yy1573:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1574;
 	if (yych != 'c') goto yy1331;
 yy1574:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'K') goto yy1575;
 	if (yych != 'k') goto yy1331;
 yy1575:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Q') goto yy1576;
 	if (yych != 'q') goto yy1331;
 yy1576:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1577;
 	if (yych != 'u') goto yy1331;
 yy1577:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1578;
 	if (yych != 'o') goto yy1331;
 yy1578:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1579;
 	if (yych != 't') goto yy1331;
 yy1579:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1580:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'Y') goto yy1490;
 	if (yych == 'y') goto yy1490;
 	goto yy1331;
 yy1581:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1582;
 	if (yych != 't') goto yy1331;
 yy1582:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1583;
 	if (yych != 'o') goto yy1331;
 yy1583:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'N') goto yy1490;
 	if (yych == 'n') goto yy1490;
 	goto yy1331;
 yy1584:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1585;
 	if (yych != 'r') goto yy1331;
 yy1585:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1586;
 	if (yych != 'a') goto yy1331;
 yy1586:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'M') goto yy1587;
 	if (yych != 'm') goto yy1331;
 yy1587:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1588:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1593;
 	if (yych == 'r') goto yy1593;
 	goto yy1331;
 yy1589:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'A') goto yy1590;
 	if (yych != 'a') goto yy1331;
 yy1590:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1591;
 	if (yych != 'd') goto yy1331;
 yy1591:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1592;
 	if (yych != 'e') goto yy1331;
 yy1592:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1490;
 	if (yych == 'r') goto yy1490;
 	goto yy1331;
 yy1593:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'O') goto yy1594;
 	if (yych != 'o') goto yy1331;
 yy1594:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'U') goto yy1595;
 	if (yych != 'u') goto yy1331;
 yy1595:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'P') goto yy1490;
 	if (yych == 'p') goto yy1490;
 	goto yy1331;
 yy1596:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1602;
 	if (yych == 'i') goto yy1602;
 	goto yy1331;
 yy1597:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'T') goto yy1598;
 	if (yych != 't') goto yy1331;
 yy1598:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'I') goto yy1599;
 	if (yych != 'i') goto yy1331;
 yy1599:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'C') goto yy1600;
 	if (yych != 'c') goto yy1331;
 yy1600:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'L') goto yy1601;
 	if (yych != 'l') goto yy1331;
 yy1601:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1602:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'D') goto yy1603;
 	if (yych != 'd') goto yy1331;
 yy1603:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1490;
 	if (yych == 'e') goto yy1490;
 	goto yy1331;
 yy1604:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'O') {
 		if (yych == 'E') goto yy1490;
 		if (yych <= 'N') goto yy1331;
@@ -13386,24 +14825,28 @@ yy1604:
 			if (yych != 'o') goto yy1331;
 		}
 	}
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'G') goto yy1606;
 	if (yych != 'g') goto yy1331;
 yy1606:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'R') goto yy1607;
 	if (yych != 'r') goto yy1331;
 yy1607:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'E') goto yy1608;
 	if (yych != 'e') goto yy1331;
 yy1608:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == 'S') goto yy1609;
 	if (yych != 's') goto yy1331;
 yy1609:
-	++p;
-	if ((yych = *p) == 'S') goto yy1490;
+	YYSKIP ();
+	if ((yych = YYPEEK ()) == 'S') goto yy1490;
 	if (yych == 's') goto yy1490;
 	goto yy1331;
 }
@@ -13414,7 +14857,7 @@ yy1609:
 // This may optionally be contained in <..>; otherwise
 // whitespace and unbalanced right parentheses aren't allowed.
 // Newlines aren't ever allowed.
-int _scan_link_url(const unsigned char *p)
+int _scan_link_url(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -13456,7 +14899,7 @@ int _scan_link_url(const unsigned char *p)
 		112, 112, 112, 112, 112, 112, 112, 112, 
 		112, 112, 112, 112, 112, 112, 112, 112, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '(') {
 		if (yych <= 0x1F) {
 			if (yych == '\n') goto yy1613;
@@ -13480,8 +14923,9 @@ yy1612:
 	{ return (p - start); }
 yy1613:
 	yyaccept = 0;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 yy1614:
 	if (yybm[0+yych] & 8) {
 		goto yy1613;
@@ -13502,11 +14946,15 @@ yy1614:
 	}
 yy1615:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	goto yy1614;
 yy1616:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1629;
 	}
@@ -13526,11 +14974,13 @@ yy1616:
 	}
 yy1617:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	goto yy1627;
 yy1618:
-	++p;
-	if ((yych = *p) <= '@') {
+	YYSKIP ();
+	if ((yych = YYPEEK ()) <= '@') {
 		if (yych <= ' ') goto yy1619;
 		if (yych <= '/') goto yy1626;
 		if (yych >= ':') goto yy1626;
@@ -13546,16 +14996,19 @@ yy1619:
 	{ return 0; }
 yy1620:
 	yyaccept = 1;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= ' ') goto yy1619;
 	if (yych == '(') goto yy1619;
 	goto yy1623;
 yy1621:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1619;
 yy1622:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1623:
 	if (yybm[0+yych] & 16) {
 		goto yy1622;
@@ -13564,7 +15017,7 @@ yy1623:
 	if (yych <= ')') goto yy1626;
 	goto yy1625;
 yy1624:
-	p = marker;
+	YYRESTORE ();
 	if (yyaccept <= 1) {
 		if (yyaccept == 0) {
 			goto yy1612;
@@ -13575,8 +15028,8 @@ yy1624:
 		goto yy1632;
 	}
 yy1625:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= ' ') goto yy1624;
 		if (yych <= '/') goto yy1622;
@@ -13594,8 +15047,9 @@ yy1625:
 	}
 yy1626:
 	yyaccept = 0;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 yy1627:
 	if (yych <= '(') {
 		if (yych <= ' ') goto yy1612;
@@ -13606,8 +15060,8 @@ yy1627:
 		if (yych != '\\') goto yy1626;
 	}
 yy1628:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= ' ') goto yy1624;
 		if (yych <= '/') goto yy1626;
@@ -13625,8 +15079,9 @@ yy1628:
 	}
 yy1629:
 	yyaccept = 0;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1629;
 	}
@@ -13645,14 +15100,16 @@ yy1629:
 	}
 yy1631:
 	yyaccept = 2;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= ' ') goto yy1632;
 	if (yych != ')') goto yy1627;
 yy1632:
 	{ return (p - start); }
 yy1633:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '>') {
 		if (yych <= ' ') {
 			if (yych <= 0x00) goto yy1624;
@@ -13678,8 +15135,8 @@ yy1633:
 		}
 	}
 yy1634:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ')') {
 		if (yych <= '\n') {
 			if (yych <= 0x00) goto yy1624;
@@ -13700,19 +15157,20 @@ yy1634:
 		}
 	}
 yy1636:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1636;
 	}
 	if (yych <= '<') goto yy1624;
 	if (yych >= '?') goto yy1639;
 yy1638:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1632;
 yy1639:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1639;
 	}
@@ -13724,8 +15182,9 @@ yy1639:
 		if (yych != '>') goto yy1636;
 	}
 	yyaccept = 2;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1636;
 	}
@@ -13734,13 +15193,15 @@ yy1639:
 	goto yy1639;
 yy1642:
 	yyaccept = 2;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= ' ') goto yy1632;
 	if (yych == '(') goto yy1632;
 	goto yy1623;
 yy1643:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '>') {
 		if (yych <= ' ') {
 			if (yych <= 0x00) goto yy1624;
@@ -13766,8 +15227,9 @@ yy1643:
 	}
 yy1644:
 	yyaccept = 2;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= ')') {
 		if (yych <= '\n') {
 			if (yych <= 0x00) goto yy1632;
@@ -13790,8 +15252,8 @@ yy1644:
 		}
 	}
 yy1645:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '(') {
 		if (yych <= '\n') {
 			if (yych <= 0x00) goto yy1624;
@@ -13814,8 +15276,9 @@ yy1645:
 	}
 yy1646:
 	yyaccept = 2;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1629;
 	}
@@ -13835,8 +15298,9 @@ yy1646:
 	}
 yy1647:
 	yyaccept = 0;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= '(') {
 		if (yych <= '\n') {
 			if (yych <= 0x00) goto yy1612;
@@ -13864,7 +15328,7 @@ yy1647:
 // Try to match a link title (in single quotes, in double quotes, or
 // in parentheses), returning number of chars matched.  Allow one
 // level of internal nesting (quotes within quotes).
-int _scan_link_title(const unsigned char *p)
+int _scan_link_title(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -13906,7 +15370,7 @@ int _scan_link_title(const unsigned char *p)
 		208, 208, 208, 208, 208, 208, 208, 208, 
 		208, 208, 208, 208, 208, 208, 208, 208, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '"') {
 		if (yych == '\n') goto yy1650;
 		if (yych <= '!') goto yy1654;
@@ -13921,25 +15385,32 @@ yy1650:
 	{ return 0; }
 yy1651:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1650;
 	goto yy1671;
 yy1652:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1650;
 	goto yy1664;
 yy1653:
 	yyaccept = 0;
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= 0x00) goto yy1650;
 	goto yy1656;
 yy1654:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1650;
 yy1655:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1656:
 	if (yybm[0+yych] & 16) {
 		goto yy1655;
@@ -13948,7 +15419,7 @@ yy1656:
 	if (yych <= ')') goto yy1660;
 	goto yy1658;
 yy1657:
-	p = marker;
+	YYRESTORE ();
 	if (yyaccept <= 1) {
 		if (yyaccept == 0) {
 			goto yy1650;
@@ -13963,8 +15434,8 @@ yy1657:
 		}
 	}
 yy1658:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 16) {
 		goto yy1655;
 	}
@@ -13972,13 +15443,14 @@ yy1658:
 	if (yych <= ')') goto yy1662;
 	goto yy1658;
 yy1660:
-	++p;
+	YYSKIP ();
 yy1661:
 	{ return (p - start); }
 yy1662:
 	yyaccept = 1;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 16) {
 		goto yy1655;
 	}
@@ -13986,8 +15458,8 @@ yy1662:
 	if (yych <= ')') goto yy1660;
 	goto yy1658;
 yy1663:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1664:
 	if (yybm[0+yych] & 64) {
 		goto yy1663;
@@ -13995,8 +15467,8 @@ yy1664:
 	if (yych <= 0x00) goto yy1657;
 	if (yych <= '\'') goto yy1667;
 yy1665:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1663;
 	}
@@ -14004,13 +15476,14 @@ yy1665:
 	if (yych <= '\'') goto yy1669;
 	goto yy1665;
 yy1667:
-	++p;
+	YYSKIP ();
 yy1668:
 	{ return (p - start); }
 yy1669:
 	yyaccept = 2;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1663;
 	}
@@ -14018,8 +15491,8 @@ yy1669:
 	if (yych <= '\'') goto yy1667;
 	goto yy1665;
 yy1670:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1671:
 	if (yybm[0+yych] & 128) {
 		goto yy1670;
@@ -14027,8 +15500,8 @@ yy1671:
 	if (yych <= 0x00) goto yy1657;
 	if (yych <= '"') goto yy1674;
 yy1672:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1670;
 	}
@@ -14036,13 +15509,14 @@ yy1672:
 	if (yych <= '"') goto yy1676;
 	goto yy1672;
 yy1674:
-	++p;
+	YYSKIP ();
 yy1675:
 	{ return (p - start); }
 yy1676:
 	yyaccept = 3;
-	marker = ++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1670;
 	}
@@ -14054,7 +15528,7 @@ yy1676:
 }
 
 // Match space characters, including newlines.
-int _scan_spacechars(const unsigned char *p)
+int _scan_spacechars(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *start = p; \
 
@@ -14094,7 +15568,7 @@ int _scan_spacechars(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '\n') {
 		if (yych <= 0x08) goto yy1683;
 		if (yych <= '\t') goto yy1680;
@@ -14107,25 +15581,26 @@ int _scan_spacechars(const unsigned char *p)
 yy1679:
 	{ return (p - start); }
 yy1680:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1682;
 yy1681:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1682:
 	if (yybm[0+yych] & 128) {
 		goto yy1681;
 	}
 	goto yy1679;
 yy1683:
-	++p;
+	YYSKIP ();
 	{ return 0; }
 }
 
 }
 
 // Match ATX header start.
-int _scan_atx_header_start(const unsigned char *p)
+int _scan_atx_header_start(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -14166,14 +15641,16 @@ int _scan_atx_header_start(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1687;
 	if (yych == '#') goto yy1688;
 	goto yy1689;
 yy1687:
 	{ return 0; }
 yy1688:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
@@ -14181,50 +15658,55 @@ yy1688:
 	if (yych == '#') goto yy1694;
 	goto yy1687;
 yy1689:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1687;
 yy1690:
-	++p;
+	YYSKIP ();
 yy1691:
 	{ return (p - start); }
 yy1692:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
 	goto yy1691;
 yy1694:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
 	if (yych == '\n') goto yy1690;
 	if (yych == '#') goto yy1696;
 yy1695:
-	p = marker;
+	YYRESTORE ();
 	goto yy1687;
 yy1696:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
 	if (yych == '\n') goto yy1690;
 	if (yych != '#') goto yy1695;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
 	if (yych == '\n') goto yy1690;
 	if (yych != '#') goto yy1695;
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1692;
 	}
 	if (yych == '\n') goto yy1690;
 	if (yych != '#') goto yy1695;
-	++p;
-	if (yybm[0+(yych = *p)] & 128) {
+	YYSKIP ();
+	if (yybm[0+(yych = YYPEEK ())] & 128) {
 		goto yy1692;
 	}
 	if (yych == '\n') goto yy1690;
@@ -14235,7 +15717,7 @@ yy1696:
 
 // Match sexext header line.  Return 1 for level-1 header,
 // 2 for level-2, 0 for no match.
-int _scan_setext_header_line(const unsigned char *p)
+int _scan_setext_header_line(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
 
@@ -14275,7 +15757,7 @@ int _scan_setext_header_line(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= ',') {
 		if (yych != '\n') goto yy1705;
 	} else {
@@ -14286,7 +15768,9 @@ int _scan_setext_header_line(const unsigned char *p)
 yy1702:
 	{ return 0; }
 yy1703:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1717;
 	}
@@ -14294,7 +15778,9 @@ yy1703:
 	if (yych == ' ') goto yy1713;
 	goto yy1702;
 yy1704:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1706;
 	}
@@ -14302,24 +15788,25 @@ yy1704:
 	if (yych == '-') goto yy1711;
 	goto yy1702;
 yy1705:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1702;
 yy1706:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1706;
 	}
 	if (yych == '\n') goto yy1709;
 yy1708:
-	p = marker;
+	YYRESTORE ();
 	goto yy1702;
 yy1709:
-	++p;
+	YYSKIP ();
 	{ return 2; }
 yy1711:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1706;
 	}
@@ -14327,17 +15814,17 @@ yy1711:
 	if (yych == '-') goto yy1711;
 	goto yy1708;
 yy1713:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1715;
 	if (yych == ' ') goto yy1713;
 	goto yy1708;
 yy1715:
-	++p;
+	YYSKIP ();
 	{ return 1; }
 yy1717:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1717;
 	}
@@ -14351,7 +15838,7 @@ yy1717:
 // Scan a horizontal rule line: "...three or more hyphens, asterisks,
 // or underscores on a line by themselves. If you wish, you may use
 // spaces between the hyphens or asterisks."
-int _scan_hrule(const unsigned char *p)
+int _scan_hrule(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -14392,7 +15879,7 @@ int _scan_hrule(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '*') {
 		if (yych == '\n') goto yy1721;
 		if (yych <= ')') goto yy1725;
@@ -14409,43 +15896,50 @@ int _scan_hrule(const unsigned char *p)
 yy1721:
 	{ return 0; }
 yy1722:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1747;
 	if (yych == '*') goto yy1749;
 	goto yy1721;
 yy1723:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1737;
 	if (yych == '_') goto yy1739;
 	goto yy1721;
 yy1724:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 8) {
 		goto yy1726;
 	}
 	if (yych == '-') goto yy1729;
 	goto yy1721;
 yy1725:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1721;
 yy1726:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 8) {
 		goto yy1726;
 	}
 	if (yych == '-') goto yy1729;
 yy1728:
-	p = marker;
+	YYRESTORE ();
 	goto yy1721;
 yy1729:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1729;
 	if (yych != '-') goto yy1728;
 yy1731:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 16) {
 		goto yy1731;
 	}
@@ -14454,29 +15948,29 @@ yy1731:
 	if (yych <= '\n') goto yy1735;
 	goto yy1728;
 yy1733:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1733;
 	}
 	if (yych <= 0x08) goto yy1728;
 	if (yych >= '\v') goto yy1728;
 yy1735:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1737:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1737;
 	if (yych != '_') goto yy1728;
 yy1739:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1739;
 	if (yych != '_') goto yy1728;
 yy1741:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1741;
 	}
@@ -14485,8 +15979,8 @@ yy1741:
 	if (yych <= '\n') goto yy1745;
 	goto yy1728;
 yy1743:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '\n') {
 		if (yych <= 0x08) goto yy1728;
 		if (yych <= '\t') goto yy1743;
@@ -14495,21 +15989,21 @@ yy1743:
 		goto yy1728;
 	}
 yy1745:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1747:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1747;
 	if (yych != '*') goto yy1728;
 yy1749:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ' ') goto yy1749;
 	if (yych != '*') goto yy1728;
 yy1751:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1751;
 	}
@@ -14518,8 +16012,8 @@ yy1751:
 	if (yych <= '\n') goto yy1755;
 	goto yy1728;
 yy1753:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '\n') {
 		if (yych <= 0x08) goto yy1728;
 		if (yych <= '\t') goto yy1753;
@@ -14528,14 +16022,14 @@ yy1753:
 		goto yy1728;
 	}
 yy1755:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 }
 
 }
 
 // Scan an opening code fence.
-int _scan_open_code_fence(const unsigned char *p)
+int _scan_open_code_fence(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -14576,7 +16070,7 @@ int _scan_open_code_fence(const unsigned char *p)
 		160, 160, 160, 160, 160, 160, 160, 160, 
 		160, 160, 160, 160, 160, 160, 160, 160, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '_') {
 		if (yych != '\n') goto yy1762;
 	} else {
@@ -14587,28 +16081,34 @@ int _scan_open_code_fence(const unsigned char *p)
 yy1759:
 	{ return 0; }
 yy1760:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '`') goto yy1771;
 	goto yy1759;
 yy1761:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '~') goto yy1763;
 	goto yy1759;
 yy1762:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1759;
 yy1763:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 16) {
 		goto yy1765;
 	}
 yy1764:
-	p = marker;
+	YYRESTORE ();
 	goto yy1759;
 yy1765:
-	marker = p + 1;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUPCTX ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1767;
 	}
@@ -14616,27 +16116,28 @@ yy1765:
 	if (yych <= '\n') goto yy1769;
 	goto yy1765;
 yy1767:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1767;
 	}
 	if (yych <= 0x00) goto yy1764;
 	if (yych >= '\v') goto yy1764;
 yy1769:
-	++p;
-	p = marker;
+	YYSKIP ();
+	YYRESTORECTX ();
 	{ return (p - start); }
 yy1771:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1772;
 	}
 	goto yy1764;
 yy1772:
-	marker = p + 1;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUPCTX ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1774;
 	}
@@ -14644,23 +16145,23 @@ yy1772:
 	if (yych <= '\n') goto yy1776;
 	goto yy1772;
 yy1774:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1774;
 	}
 	if (yych <= 0x00) goto yy1764;
 	if (yych >= '\v') goto yy1764;
 yy1776:
-	++p;
-	p = marker;
+	YYSKIP ();
+	YYRESTORECTX ();
 	{ return (p - start); }
 }
 
 }
 
 // Scan a closing code fence with length at least len.
-int _scan_close_code_fence(const unsigned char *p)
+int _scan_close_code_fence(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
@@ -14701,7 +16202,7 @@ int _scan_close_code_fence(const unsigned char *p)
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 		  0,   0,   0,   0,   0,   0,   0,   0, 
 	};
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych <= '_') {
 		if (yych != '\n') goto yy1783;
 	} else {
@@ -14712,28 +16213,34 @@ int _scan_close_code_fence(const unsigned char *p)
 yy1780:
 	{ return 0; }
 yy1781:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '`') goto yy1792;
 	goto yy1780;
 yy1782:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych == '~') goto yy1784;
 	goto yy1780;
 yy1783:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1780;
 yy1784:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 32) {
 		goto yy1786;
 	}
 yy1785:
-	p = marker;
+	YYRESTORE ();
 	goto yy1780;
 yy1786:
-	marker = p + 1;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUPCTX ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1788;
 	}
@@ -14742,27 +16249,28 @@ yy1786:
 	if (yych == '~') goto yy1786;
 	goto yy1785;
 yy1788:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 64) {
 		goto yy1788;
 	}
 	if (yych <= 0x08) goto yy1785;
 	if (yych >= '\v') goto yy1785;
 yy1790:
-	++p;
-	p = marker;
+	YYSKIP ();
+	YYRESTORECTX ();
 	{ return (p - start); }
 yy1792:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1793;
 	}
 	goto yy1785;
 yy1793:
-	marker = p + 1;
-	++p;
-	yych = *p;
+	YYSKIP ();
+	YYBACKUPCTX ();
+	yych = YYPEEK ();
 	if (yybm[0+yych] & 128) {
 		goto yy1793;
 	}
@@ -14773,8 +16281,8 @@ yy1793:
 		if (yych != ' ') goto yy1785;
 	}
 yy1795:
-	++p;
-	yych = *p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '\n') {
 		if (yych <= 0x08) goto yy1785;
 		if (yych <= '\t') goto yy1795;
@@ -14783,8 +16291,8 @@ yy1795:
 		goto yy1785;
 	}
 yy1797:
-	++p;
-	p = marker;
+	YYSKIP ();
+	YYRESTORECTX ();
 	{ return (p - start); }
 }
 
@@ -14792,21 +16300,23 @@ yy1797:
 
 // Scans an entity.
 // Returns number of chars matched.
-int _scan_entity(const unsigned char *p)
+int _scan_entity(const unsigned char *p, const unsigned char *end)
 {
   const unsigned char *marker = NULL;
   const unsigned char *start = p;
 
 {
 	unsigned char yych;
-	yych = *p;
+	yych = YYPEEK ();
 	if (yych == '\n') goto yy1801;
 	if (yych == '&') goto yy1802;
 	goto yy1803;
 yy1801:
 	{ return 0; }
 yy1802:
-	yych = *(marker = ++p);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych == '#') goto yy1804;
 		goto yy1801;
@@ -14817,10 +16327,12 @@ yy1802:
 		goto yy1801;
 	}
 yy1803:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1801;
 yy1804:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= 'W') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1841;
@@ -14829,10 +16341,11 @@ yy1804:
 		if (yych == 'x') goto yy1840;
 	}
 yy1805:
-	p = marker;
+	YYRESTORE ();
 	goto yy1801;
 yy1806:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy1805;
 		if (yych >= ':') goto yy1805;
@@ -14842,7 +16355,8 @@ yy1806:
 		if (yych >= '{') goto yy1805;
 	}
 yy1807:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1810;
@@ -14858,10 +16372,11 @@ yy1807:
 		}
 	}
 yy1808:
-	++p;
+	YYSKIP ();
 	{ return (p - start); }
 yy1810:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1811;
@@ -14876,7 +16391,8 @@ yy1810:
 		}
 	}
 yy1811:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1812;
@@ -14891,7 +16407,8 @@ yy1811:
 		}
 	}
 yy1812:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1813;
@@ -14906,7 +16423,8 @@ yy1812:
 		}
 	}
 yy1813:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1814;
@@ -14921,7 +16439,8 @@ yy1813:
 		}
 	}
 yy1814:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1815;
@@ -14936,7 +16455,8 @@ yy1814:
 		}
 	}
 yy1815:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1816;
@@ -14951,7 +16471,8 @@ yy1815:
 		}
 	}
 yy1816:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1817;
@@ -14966,7 +16487,8 @@ yy1816:
 		}
 	}
 yy1817:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1818;
@@ -14981,7 +16503,8 @@ yy1817:
 		}
 	}
 yy1818:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1819;
@@ -14996,7 +16519,8 @@ yy1818:
 		}
 	}
 yy1819:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1820;
@@ -15011,7 +16535,8 @@ yy1819:
 		}
 	}
 yy1820:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1821;
@@ -15026,7 +16551,8 @@ yy1820:
 		}
 	}
 yy1821:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1822;
@@ -15041,7 +16567,8 @@ yy1821:
 		}
 	}
 yy1822:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1823;
@@ -15056,7 +16583,8 @@ yy1822:
 		}
 	}
 yy1823:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1824;
@@ -15071,7 +16599,8 @@ yy1823:
 		}
 	}
 yy1824:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1825;
@@ -15086,7 +16615,8 @@ yy1824:
 		}
 	}
 yy1825:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1826;
@@ -15101,7 +16631,8 @@ yy1825:
 		}
 	}
 yy1826:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1827;
@@ -15116,7 +16647,8 @@ yy1826:
 		}
 	}
 yy1827:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1828;
@@ -15131,7 +16663,8 @@ yy1827:
 		}
 	}
 yy1828:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1829;
@@ -15146,7 +16679,8 @@ yy1828:
 		}
 	}
 yy1829:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1830;
@@ -15161,7 +16695,8 @@ yy1829:
 		}
 	}
 yy1830:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1831;
@@ -15176,7 +16711,8 @@ yy1830:
 		}
 	}
 yy1831:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1832;
@@ -15191,7 +16727,8 @@ yy1831:
 		}
 	}
 yy1832:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1833;
@@ -15206,7 +16743,8 @@ yy1832:
 		}
 	}
 yy1833:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1834;
@@ -15221,7 +16759,8 @@ yy1833:
 		}
 	}
 yy1834:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1835;
@@ -15236,7 +16775,8 @@ yy1834:
 		}
 	}
 yy1835:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1836;
@@ -15251,7 +16791,8 @@ yy1835:
 		}
 	}
 yy1836:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1837;
@@ -15266,7 +16807,8 @@ yy1836:
 		}
 	}
 yy1837:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1838;
@@ -15281,7 +16823,8 @@ yy1837:
 		}
 	}
 yy1838:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1839;
@@ -15296,11 +16839,13 @@ yy1838:
 		}
 	}
 yy1839:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1840:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '@') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1848;
@@ -15312,49 +16857,57 @@ yy1840:
 		goto yy1805;
 	}
 yy1841:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1842;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1842:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1843;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1843:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1844;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1844:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1845;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1845:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1846;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1846:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1847;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1847:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= '/') goto yy1805;
 	if (yych <= '9') goto yy1839;
 	if (yych == ';') goto yy1808;
 	goto yy1805;
 yy1848:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1849;
@@ -15369,7 +16922,8 @@ yy1848:
 		}
 	}
 yy1849:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1850;
@@ -15384,7 +16938,8 @@ yy1849:
 		}
 	}
 yy1850:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1851;
@@ -15399,7 +16954,8 @@ yy1850:
 		}
 	}
 yy1851:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1852;
@@ -15414,7 +16970,8 @@ yy1851:
 		}
 	}
 yy1852:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1853;
@@ -15429,7 +16986,8 @@ yy1852:
 		}
 	}
 yy1853:
-	yych = *++p;
+	YYSKIP ();
+	yych = YYPEEK ();
 	if (yych <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1854;
@@ -15444,8 +17002,8 @@ yy1853:
 		}
 	}
 yy1854:
-	++p;
-	if ((yych = *p) <= ';') {
+	YYSKIP ();
+	if ((yych = YYPEEK ()) <= ';') {
 		if (yych <= '/') goto yy1805;
 		if (yych <= '9') goto yy1839;
 		if (yych <= ':') goto yy1805;
@@ -5,23 +5,24 @@
 extern "C" {
 #endif
 
-int _scan_at(int (*scanner)(const unsigned char *), cmark_chunk *c, int offset);
-int _scan_scheme(const unsigned char *p);
-int _scan_autolink_uri(const unsigned char *p);
-int _scan_autolink_email(const unsigned char *p);
-int _scan_autolink_inline(const unsigned char *p);
-int _scan_toc_inline(const unsigned char *p);
-int _scan_html_tag(const unsigned char *p);
-int _scan_html_block_tag(const unsigned char *p);
-int _scan_link_url(const unsigned char *p);
-int _scan_link_title(const unsigned char *p);
-int _scan_spacechars(const unsigned char *p);
-int _scan_atx_header_start(const unsigned char *p);
-int _scan_setext_header_line(const unsigned char *p);
-int _scan_hrule(const unsigned char *p);
-int _scan_open_code_fence(const unsigned char *p);
-int _scan_close_code_fence(const unsigned char *p);
-int _scan_entity(const unsigned char *p);
+int _scan_at(int (*scanner)(const unsigned char *, const unsigned char *),
+             cmark_chunk *c, int offset);
+int _scan_scheme(const unsigned char *p, const unsigned char *end);
+int _scan_autolink_uri(const unsigned char *p, const unsigned char *end);
+int _scan_autolink_email(const unsigned char *p, const unsigned char *end);
+int _scan_autolink_inline(const unsigned char *p, const unsigned char *end);
+int _scan_toc_inline(const unsigned char *p, const unsigned char *end);
+int _scan_html_tag(const unsigned char *p, const unsigned char *end);
+int _scan_html_block_tag(const unsigned char *p, const unsigned char *end);
+int _scan_link_url(const unsigned char *p, const unsigned char *end);
+int _scan_link_title(const unsigned char *p, const unsigned char *end);
+int _scan_spacechars(const unsigned char *p, const unsigned char *end);
+int _scan_atx_header_start(const unsigned char *p, const unsigned char *end);
+int _scan_setext_header_line(const unsigned char *p, const unsigned char *end);
+int _scan_hrule(const unsigned char *p, const unsigned char *end);
+int _scan_open_code_fence(const unsigned char *p, const unsigned char *end);
+int _scan_close_code_fence(const unsigned char *p, const unsigned char *end);
+int _scan_entity(const unsigned char *p, const unsigned char *end);
 
 #define scan_scheme(c, n) _scan_at(&_scan_scheme, c, n)
 #define scan_autolink_uri(c, n) _scan_at(&_scan_autolink_uri, c, n)
@@ -0,0 +1,44 @@
+// for clock_gettime() when compiling as C99
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+
+#include "config.h"
+#include "stats.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+
+uint64_t cmark_stats_clock(void)
+{
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER now;
+
+	if (freq.QuadPart == 0) {
+		QueryPerformanceFrequency(&freq);
+	}
+	QueryPerformanceCounter(&now);
+	return (uint64_t)(now.QuadPart / freq.QuadPart) * 1000000000 +
+	       (uint64_t)(now.QuadPart % freq.QuadPart) * 1000000000 /
+	       (uint64_t)freq.QuadPart;
+}
+
+#elif defined(HAVE_CLOCK_GETTIME)
+
+uint64_t cmark_stats_clock(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+#else
+
+// processor time is the best there is
+uint64_t cmark_stats_clock(void)
+{
+	return (uint64_t)clock() * (1000000000 / CLOCKS_PER_SEC);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef CMARK_STATS_H
+#define CMARK_STATS_H
+
+#include <stdint.h>
+
+#include "cmark.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the time of a monotonic clock in nanoseconds.
+uint64_t cmark_stats_clock(void);
+
+// Time a phase for a cmark_parser_stats that may be NULL:
+//
+//     uint64_t start = cmark_stats_start(stats);
+//     ...
+//     cmark_stats_end(stats, render_ns, start);
+//
+// A phase that can run during another one is not counted twice if the
+// caller adds its time to 'start' before ending the outer phase.
+#define cmark_stats_start(stats) ((stats) ? cmark_stats_clock() : 0)
+
+#define cmark_stats_end(stats, phase, start)                            \
+	do {                                                            \
+		if (stats) {                                            \
+			(stats)->phase += cmark_stats_clock() - (start); \
+		}                                                       \
+	} while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,65 @@
+#include "config.h"
+#include "trace.h"
+
+#ifdef CMARK_TRACE
+
+#ifdef HAVE_SYS_SDT_H
+#include <sys/sdt.h>
+#endif
+
+static cmark_trace_callback trace_callback;
+static void *trace_data;
+static uint64_t documents;
+
+int cmark_set_trace_callback(cmark_trace_callback callback, void *data)
+{
+	trace_data = data;
+	trace_callback = callback;
+	return 1;
+}
+
+uint64_t cmark_trace_new_document(void)
+{
+#ifdef __GNUC__
+	// parsers may be made in several threads
+	return __sync_add_and_fetch(&documents, 1);
+#else
+	return ++documents;
+#endif
+}
+
+void cmark_trace_emit(cmark_trace_stage stage, int end, uint64_t document,
+                      uint64_t offset, const cmark_parser_stats *stats)
+{
+	cmark_trace_callback callback = trace_callback;
+
+#ifdef HAVE_SYS_SDT_H
+	if (end) {
+		DTRACE_PROBE4(cmark, stage_end, stage, document, offset, stats);
+	} else {
+		DTRACE_PROBE4(cmark, stage_begin, stage, document, offset,
+		              stats);
+	}
+#endif
+	if (callback) {
+		cmark_trace_event event;
+
+		event.stage = stage;
+		event.end = end;
+		event.document = document;
+		event.offset = offset;
+		event.stats = stats;
+		callback(&event, trace_data);
+	}
+}
+
+#else
+
+int cmark_set_trace_callback(cmark_trace_callback callback, void *data)
+{
+	(void)callback;
+	(void)data;
+	return 0;
+}
+
+#endif
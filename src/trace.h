@@ -0,0 +1,47 @@
+#ifndef CMARK_TRACE_H
+#define CMARK_TRACE_H
+
+#include <stdint.h>
+
+#include "cmark.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Reports a stage of the processing of a document to the trace
+// callback and the static probes:
+//
+//     cmark_trace_begin(RENDER, cmark_document_id(root), 0, stats);
+//     ...
+//     cmark_trace_end(RENDER, cmark_document_id(root), 0, stats);
+//
+// Without CMARK_TRACE these compile to nothing, and documents have no
+// number.
+
+#ifdef CMARK_TRACE
+
+void cmark_trace_emit(cmark_trace_stage stage, int end, uint64_t document,
+                      uint64_t offset, const cmark_parser_stats *stats);
+
+// Returns the number of a new document.
+uint64_t cmark_trace_new_document(void);
+
+#define cmark_trace_begin(stage, document, offset, stats) \
+	cmark_trace_emit(CMARK_TRACE_##stage, 0, document, offset, stats)
+#define cmark_trace_end(stage, document, offset, stats) \
+	cmark_trace_emit(CMARK_TRACE_##stage, 1, document, offset, stats)
+
+#else
+
+#define cmark_trace_new_document() 0
+#define cmark_trace_begin(stage, document, offset, stats) ((void)0)
+#define cmark_trace_end(stage, document, offset, stats) ((void)0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
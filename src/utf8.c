@@ -110,11 +110,12 @@ static int utf8proc_valid(const uint8_t *str, int str_len)
 	return length;
 }
 
-void utf8proc_detab(cmark_strbuf *ob, const uint8_t *line, size_t size)
+int utf8proc_detab(cmark_strbuf *ob, const uint8_t *line, size_t size)
 {
 	static const uint8_t whitespace[] = "    ";
 
 	size_t i = 0, tab = 0;
+	int verbatim = 1;
 
 	while (i < size) {
 		size_t org = i;
@@ -138,6 +139,7 @@ void utf8proc_detab(cmark_strbuf *ob, const uint8_t *line, size_t size)
 
 		if (line[i] == '\t') {
 			int numspaces = 4 - (tab % 4);
+			verbatim = 0;
 			cmark_strbuf_put(ob, whitespace, numspaces);
 			i += 1;
 			tab += numspaces;
@@ -149,12 +151,15 @@ void utf8proc_detab(cmark_strbuf *ob, const uint8_t *line, size_t size)
 			} else {
 				encode_unknown(ob);
 				charlen = -charlen;
+				verbatim = 0;
 			}
 
 			i += charlen;
 			tab += 1;
 		}
 	}
+
+	return verbatim;
 }
 
 int utf8proc_iterate(const uint8_t *str, int str_len, int32_t *dst)
@@ -8,6 +8,10 @@
 #include "node.h"
 #include "buffer.h"
 #include "houdini.h"
+#include "doc.h"
+#include "stats.h"
+#include "trace.h"
+#include "governor.h"
 
 // Functions to convert cmark_nodes to XML strings.
 
@@ -21,6 +25,10 @@ static void escape_xml(cmark_strbuf *dest, const unsigned char *source, int leng
 	}
 }
 
+// Indentation stops growing here, or deeply nested documents would
+// render to output quadratic in their size.
+#define MAX_INDENT 40
+
 struct render_state {
 	cmark_strbuf* xml;
 	int indent;
@@ -29,7 +37,7 @@ struct render_state {
 static inline void indent(struct render_state *state)
 {
 	int i;
-	for (i = 0; i < state->indent; i++) {
+	for (i = 0; i < state->indent && i < MAX_INDENT; i++) {
 		cmark_strbuf_putc(state->xml, ' ');
 	}
 }
@@ -40,6 +48,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 {
 	cmark_strbuf *xml = state->xml;
 	bool literal = false;
+	cmark_chunk *content;
 	cmark_delim_type delim;
 	bool entering = (ev_type == CMARK_EVENT_ENTER);
 
@@ -48,6 +57,9 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 		cmark_strbuf_printf(xml, "<%s",
 		                    cmark_node_get_type_string(node));
 
+		if (options & CMARK_OPT_SOURCEPOS) {
+			cmark_node_ensure_position(node);
+		}
 		if (options & CMARK_OPT_SOURCEPOS && node->start_line != 0) {
 			cmark_strbuf_printf(xml, " sourcepos=\"%d:%d-%d:%d\"",
 			                    node->start_line,
@@ -64,8 +76,8 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 		case CMARK_NODE_HTML:
 		case CMARK_NODE_INLINE_HTML:
 			cmark_strbuf_puts(xml, ">");
-			escape_xml(xml, node->as.literal.data,
-			           node->as.literal.len);
+			content = cmark_node_literal(node);
+			escape_xml(xml, content->data, content->len);
 			cmark_strbuf_puts(xml, "</");
 			cmark_strbuf_puts(xml,
 			                  cmark_node_get_type_string(node));
@@ -108,8 +120,8 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 				cmark_strbuf_putc(xml, '"');
 			}
 			cmark_strbuf_puts(xml, ">");
-			escape_xml(xml, node->as.code.literal.data,
-			           node->as.code.literal.len);
+			content = cmark_node_literal(node);
+			escape_xml(xml, content->data, content->len);
 			cmark_strbuf_puts(xml, "</");
 			cmark_strbuf_puts(xml,
 			                  cmark_node_get_type_string(node));
@@ -129,7 +141,7 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 		default:
 			break;
 		}
-		if (node->first_child) {
+		if (cmark_node_first_child(node)) {
 			state->indent += 2;
 		} else if (!literal) {
 			cmark_strbuf_puts(xml, " /");
@@ -147,26 +159,86 @@ S_render_node(cmark_node *node, cmark_event_type ev_type,
 	return 1;
 }
 
+static void
+S_render_prolog(struct render_state *state)
+{
+	cmark_strbuf_puts(state->xml,
+	                  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	cmark_strbuf_puts(state->xml,
+	                  "<!DOCTYPE CommonMark SYSTEM \"CommonMark.dtd\">\n");
+}
+
 char *cmark_render_xml(cmark_node *root, int options)
 {
+	cmark_parser_stats *stats = cmark_document_stats(root);
+	cmark_governor *governor = cmark_document_governor(root);
+	uint64_t inlines = stats ? stats->inlines_ns : 0;
+	uint64_t start = cmark_stats_start(stats);
 	char *result;
 	cmark_strbuf xml = GH_BUF_INIT;
 	cmark_event_type ev_type;
-	cmark_node *cur;
+	cmark_node *cur = NULL;
 	struct render_state state = { &xml, 0 };
 
 	cmark_iter *iter = cmark_iter_new(root);
 
-	cmark_strbuf_puts(state.xml,
-	                  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-	cmark_strbuf_puts(state.xml,
-	                  "<!DOCTYPE CommonMark SYSTEM \"CommonMark.dtd\">\n");
+	cmark_trace_begin(RENDER, cmark_document_id(root), 0, stats);
+	S_render_prolog(&state);
 	while ((ev_type = cmark_iter_next(iter)) != CMARK_EVENT_DONE) {
 		cur = cmark_iter_get_node(iter);
+		if (ev_type == CMARK_EVENT_ENTER && cur != root &&
+		    cmark_governor_render_stopped(governor, xml.size)) {
+			break;
+		}
 		S_render_node(cur, ev_type, &state, options);
 	}
+	if (ev_type != CMARK_EVENT_DONE) {
+		// close the elements around the first node left out
+		while (cur != root) {
+			cur = cur->parent;
+			S_render_node(cur, CMARK_EVENT_EXIT, &state, options);
+		}
+	}
 	result = (char *)cmark_strbuf_detach(&xml);
 
 	cmark_iter_free(iter);
+	// inlines parsed lazily during the render were timed apart
+	cmark_stats_end(stats, render_ns, start + (stats->inlines_ns - inlines));
+	cmark_trace_end(RENDER, cmark_document_id(root), 0, stats);
 	return result;
 }
+
+struct doc_render_state {
+	struct render_state *state;
+	int options;
+};
+
+static int
+S_render_doc_node(cmark_node *node, cmark_event_type ev_type, void *data)
+{
+	struct doc_render_state *doc_state = (struct doc_render_state *)data;
+
+	return S_render_node(node, ev_type, doc_state->state,
+	                     doc_state->options);
+}
+
+char *cmark_doc_render_xml(cmark_doc *doc, int options)
+{
+	cmark_strbuf xml = GH_BUF_INIT;
+	struct render_state state = { &xml, 0 };
+	struct doc_render_state doc_state = { &state, options };
+
+	if (doc == NULL) {
+		return NULL;
+	}
+	if (doc->root != NULL) {
+		cmark_governor_restart(cmark_document_governor(doc->root));
+		return cmark_render_xml(doc->root, options);
+	}
+	S_render_prolog(&state);
+	if (!cmark_doc_walk(doc, S_render_doc_node, &doc_state)) {
+		cmark_strbuf_free(&xml);
+		return NULL;
+	}
+	return (char *)cmark_strbuf_detach(&xml);
+}
@@ -3,8 +3,11 @@
 
 import re
 import argparse
+import os
+import subprocess
 import sys
 import platform
+import tempfile
 from cmark import CMark
 
 if __name__ == "__main__":
@@ -13,8 +16,132 @@ if __name__ == "__main__":
             help='program to test')
     parser.add_argument('--library-dir', dest='library_dir', nargs='?',
             default=None, help='directory containing dynamic library')
+    parser.add_argument('--performance', action='store_true',
+            help='check that time and memory grow linearly with input size '
+                 '(needs --program)')
+    parser.add_argument('--generate', nargs=2, metavar=('CASE', 'N'),
+            help=argparse.SUPPRESS)
     args = parser.parse_args(sys.argv[1:])
 
+# In performance mode each case is run on inputs of size n, 2n and 4n.
+# The CPU time and peak memory above those of an empty input must not
+# grow by more than max_growth times from n to 4n: linear growth is
+# 4 times, quadratic growth 16 times.
+max_growth = 7
+# growth is not measured below these, where it is mostly noise: the
+# peak memory of a child starts at that of this process, and buffers
+# grow by doubling
+min_time = 0.02     # seconds
+min_rss = 16384     # ru_maxrss units, kilobytes on Linux
+repeats = 3
+
+# inputs as functions of n
+performance = {
+    "nested strong emph":
+                (lambda n: ("*a **a " * n) + "b" + (" a** a*" * n), 20000),
+    "unclosed emph":
+                (lambda n: "*a _b " * n, 50000),
+    "nested brackets":
+                (lambda n: ("[" * n) + "a" + ("]" * n), 50000),
+    "unclosed brackets":
+                (lambda n: "[a](" * n, 50000),
+    "nested block quotes":
+                (lambda n: ("> " * n) + "a", 20000),
+    "nested lists":
+                (lambda n: ("- " * n) + "a", 20000),
+    "many reference definitions":
+                (lambda n: "".join("[l%d]: /u%d\n" % (i, i) for i in range(n)) +
+                 "".join("\n[l%d]" % i for i in range(n)), 20000),
+    "many anchors":
+                (lambda n: "".join("{#a%d} text " % i for i in range(n)), 50000),
+    "many anchors in links":
+                (lambda n: "".join("[{#a%d}](/u) " % i for i in range(n)), 20000),
+    "long include run":
+                (lambda n: "".join("<<s%d.css>>\n" % i for i in range(n)) +
+                 "\ntext\n", 20000),
+    "many include paragraphs":
+                (lambda n: "".join("<<s%d.css>>\n\npara\n\n" % i
+                                   for i in range(n)), 10000),
+    "many headers under toc":
+                (lambda n: "{toc}\n\n" + "".join("%s h%d\n\ntext\n\n" %
+                                                 ("#" * (i % 6 + 1), i)
+                                                 for i in range(n)), 20000),
+    "many tocs":
+                (lambda n: "".join("{toc}\n\n# h%d\n\n" % i
+                                   for i in range(n)), 10000),
+    }
+
+def measure(program, case, n):
+    """Run program on the input of a case, returning its CPU time and
+    peak memory."""
+    with tempfile.TemporaryFile() as f:
+        # a child inherits the peak memory of this process, so the
+        # input is made by another one
+        subprocess.check_call([sys.executable, __file__, '--generate',
+                               case, str(n)], stdout=f)
+        best_time = best_rss = None
+        for _ in range(repeats):
+            f.seek(0)
+            p = subprocess.Popen(program.split(), stdin=f,
+                                 stdout=subprocess.DEVNULL)
+            _, status, usage = os.wait4(p.pid, 0)
+            p.returncode = status
+            if status != 0:
+                raise RuntimeError("program returned status %d" % status)
+            time = usage.ru_utime + usage.ru_stime
+            if best_time is None or time < best_time:
+                best_time = time
+            if best_rss is None or usage.ru_maxrss < best_rss:
+                best_rss = usage.ru_maxrss
+    return (best_time, best_rss)
+
+def growth(small, large, floor):
+    return max(large, floor) / max(small, floor)
+
+def run_performance(program):
+    passed = 0
+    failed = 0
+    errored = 0
+    (base_time, base_rss) = measure(program, "empty", 0)
+    print("Testing growth of time and memory:")
+    print("%-28s %8s %8s %8s %6s %8s %6s" % ("case", "n", "t(n)", "t(4n)",
+          "growth", "rss(4n)", "growth"))
+    for description in performance:
+        n = performance[description][1]
+        try:
+            results = [measure(program, description, n * k)
+                       for k in (1, 2, 4)]
+        except RuntimeError as e:
+            print(description, e)
+            errored += 1
+            continue
+        times = [max(t - base_time, 0) for (t, _) in results]
+        rsss = [max(r - base_rss, 0) for (_, r) in results]
+        time_growth = growth(times[0], times[2], min_time)
+        rss_growth = growth(rsss[0], rsss[2], min_rss)
+        print("%-28s %8d %8.3f %8.3f %6.1f %8d %6.1f" % (description, n,
+              times[0], times[2], time_growth, rsss[2], rss_growth))
+        if time_growth > max_growth or rss_growth > max_growth:
+            print(description, 'failed: grows faster than linearly')
+            failed += 1
+        else:
+            passed += 1
+    return (passed, failed, errored)
+
+if args.generate:
+    (case, n) = args.generate
+    text = performance[case][0](int(n)) if case in performance else ""
+    sys.stdout.buffer.write(text.encode('utf-8'))
+    exit(0)
+
+if args.performance:
+    if not args.program or not hasattr(os, 'wait4'):
+        print("Skipping performance tests: they need --program and os.wait4")
+        exit(0)
+    (passed, failed, errored) = run_performance(args.program)
+    print("%d passed, %d failed, %d errored" % (passed, failed, errored))
+    exit(0 if failed == 0 and errored == 0 else 1)
+
 cmark = CMark(prog=args.program, library_dir=args.library_dir)
 
 # list of pairs consisting of input and a regex that must match the output.
@@ -29,6 +156,10 @@ pathological = {
     "nested block quotes":
                  ((("> " * 50000) + "a"),
                   re.compile("(<blockquote>\n){50000}")),
+    "many reference definitions":
+                 ("".join("[l%d]: /u%d\n" % (i, i) for i in range(50000)) +
+                  "\n[l0] and [l49999]",
+                  re.compile('<a href="/u0">l0</a> and <a href="/u49999">l49999</a>')),
     "U+0000 in input":
                  ("abc\u0000de\u0000",
                   re.compile("abc\ufffd?de\ufffd?"))